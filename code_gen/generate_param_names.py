@@ -0,0 +1,49 @@
+# Copyright 2021 The Khronos Group
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import json
+import hash_gen
+import argparse
+import pathlib
+
+# Collect the names of all parameters defined by the core API and extension
+# json files and emit a perfect hash mapping each name to a fixed index. This
+# is used by helium::ParamName to intern known parameter names without locking.
+
+parser = argparse.ArgumentParser(description="Generate the table of known parameter names for helium.")
+parser.add_argument("-j", "--json", dest="json", type=pathlib.Path, action="append", help="Path to the core and extension json root.")
+parser.add_argument("-o", "--output", dest="output", type=pathlib.Path, help="Output header file")
+args = parser.parse_args()
+
+jsons = sorted([entry for j in args.json for entry in j.glob("**/*.json")])
+
+names = set()
+for path in jsons:
+    with open(path) as f:
+        spec = json.load(f)
+    for obj in spec.get("objects", []):
+        for param in obj.get("parameters", []):
+            if isinstance(param, dict) and "name" in param:
+                names.add(param["name"])
+
+names = sorted(names)
+
+with open(args.output, mode='w') as f:
+    f.write("// Copyright 2021 The Khronos Group\n")
+    f.write("// SPDX-License-Identifier: Apache-2.0\n\n")
+    f.write("// This file was generated by "+os.path.basename(__file__)+"\n")
+    f.write("// Don't make changes to this directly\n\n")
+    f.write("#pragma once\n\n")
+    f.write("#include <stddef.h>\n")
+    f.write("#include <stdint.h>\n")
+    f.write("#include <string.h>\n\n")
+    f.write("namespace helium {\n")
+    f.write("namespace known_param_names {\n\n")
+    f.write("static const uint32_t count = %d;\n\n"%len(names))
+    f.write("static const char *names[] = {\n")
+    f.write(",\n".join(["   \"%s\""%x for x in names]))
+    f.write("\n};\n\n")
+    f.write("static " + hash_gen.gen_perfect_hash_function("hash", names))
+    f.write("\n} // namespace known_param_names\n")
+    f.write("} // namespace helium\n")
@@ -77,3 +77,80 @@ def define_enums(name, keywords, values=None):
    code += "\n".join(["#define %s_%s %d"%(name.upper(), x.upper(), values[keywords.index(x)]) for x in keywords])
    code += "\n"
    return code
+
+# Seeded multiplicative hash over 8 byte little endian words. The generated
+# C++ code below has to compute exactly the same values.
+MASK64 = (1<<64)-1
+
+def word_hash(s, seed):
+   data = s.encode()
+   h = (seed ^ (len(data)*0x9e3779b97f4a7c15)) & MASK64
+   for i in range(0, len(data), 8):
+      w = int.from_bytes(data[i:i+8], 'little')
+      h = ((h ^ w)*0xff51afd7ed558ccd) & MASK64
+      h ^= h >> 32
+   return (h*0x9e3779b97f4a7c15) & MASK64
+
+def find_perfect_hash_seed(keywords, bits):
+   for seed in range(0, 1<<16):
+      slots = set([word_hash(k, seed) >> (64-bits) for k in keywords])
+      if len(slots) == len(keywords):
+         return seed
+   return None
+
+# Like gen_hash_function(), but for strings given as pointer + length: a
+# collision free seeded hash of whole words selects a single candidate, which
+# is then compared. This takes a few multiplies instead of one table lookup per
+# character.
+def gen_perfect_hash_function(name, keywords, values=None, indent=""):
+   if values==None:
+      values = range(0, len(keywords))
+
+   bits = max(1, (len(keywords)-1).bit_length()+1)
+   seed = find_perfect_hash_seed(keywords, bits)
+   while seed == None:
+      bits += 1
+      seed = find_perfect_hash_seed(keywords, bits)
+
+   # slot -> index into 'keywords' or -1
+   table = [-1]*(1<<bits)
+   for i, k in enumerate(keywords):
+      table[word_hash(k, seed) >> (64-bits)] = i
+
+   code  = ""
+   code += "int %s(const char *str, size_t len) {\n"%name
+   code += indent + "   static const char *keywords[] = {"
+   code += ",".join(["\"%s\""%x for x in keywords])
+   code += "};\n"
+   code += indent + "   static const uint32_t lengths[] = {"
+   code += ",".join(["%d"%len(x.encode()) for x in keywords])
+   code += "};\n"
+   code += indent + "   static const int32_t values[] = {"
+   code += ",".join(["%d"%x for x in values])
+   code += "};\n"
+   code += indent + "   static const int32_t table[] = {"
+   code += ",".join(["%d"%x for x in table])
+   code += "};\n"
+   code += indent + "   uint64_t h = 0x%xull^(len*0x9e3779b97f4a7c15ull);\n"%seed
+   code += indent + "   size_t i = 0;\n"
+   code += indent + "   for(;i+8<=len;i+=8) {\n"
+   code += indent + "      uint64_t w;\n"
+   code += indent + "      memcpy(&w, str+i, 8);\n"
+   code += indent + "      h = (h^w)*0xff51afd7ed558ccdull;\n"
+   code += indent + "      h ^= h>>32u;\n"
+   code += indent + "   }\n"
+   code += indent + "   if(i<len) {\n"
+   code += indent + "      uint64_t w = 0;\n"
+   code += indent + "      for(size_t j = 0;i+j<len;j++) {\n"
+   code += indent + "         w |= uint64_t((unsigned char)str[i+j])<<(8u*j);\n"
+   code += indent + "      }\n"
+   code += indent + "      h = (h^w)*0xff51afd7ed558ccdull;\n"
+   code += indent + "      h ^= h>>32u;\n"
+   code += indent + "   }\n"
+   code += indent + "   int32_t k = table[(h*0x9e3779b97f4a7c15ull)>>%du];\n"%(64-bits)
+   code += indent + "   if(k<0 || lengths[k]!=len || memcmp(keywords[k], str, len)!=0) {\n"
+   code += indent + "      return -1;\n"
+   code += indent + "   }\n"
+   code += indent + "   return values[k];\n"
+   code += indent + "}\n"
+   return code
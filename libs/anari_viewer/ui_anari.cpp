@@ -202,7 +202,7 @@ bool buildUI(Parameter &p)
         return 0;
       };
       update |= ImGui::InputText(name,
-          (char *)value,
+          (char *)p.value.data(), // reserveString() may have moved the string
           MAX_LENGTH,
           ImGuiInputTextFlags_CallbackEdit,
           text_cb,
@@ -0,0 +1,175 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "DeduplicationCache.h"
+// std
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace helide {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+static uint64_t mix(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+uint64_t hashBytes(const void *mem, size_t numBytes, uint64_t seed)
+{
+  constexpr uint64_t prime = 0x100000001b3ull;
+  uint64_t h = mix(seed ^ numBytes) ^ 0xcbf29ce484222325ull;
+
+  const auto *bytes = (const uint8_t *)mem;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= numBytes; i += sizeof(uint64_t)) {
+    uint64_t w;
+    std::memcpy(&w, bytes + i, sizeof(w));
+    h = (h ^ w) * prime;
+  }
+  for (; i < numBytes; i++)
+    h = (h ^ bytes[i]) * prime;
+
+  return mix(h);
+}
+
+static uint64_t hashSceneKey(const DeduplicationCache::SceneKey &key)
+{
+  return hashBytes(key.hashes.data(), key.hashes.size() * sizeof(uint64_t));
+}
+
+// DeduplicationCache definitions /////////////////////////////////////////////
+
+DeduplicationCache::~DeduplicationCache()
+{
+  for (auto &b : m_blocks)
+    std::free(const_cast<void *>(b.first));
+  for (auto &s : m_scenes)
+    rtcReleaseScene(s.first);
+}
+
+void *DeduplicationCache::internArrayData(void *mem, size_t numBytes)
+{
+  const uint64_t hash = hashBytes(mem, numBytes);
+
+  auto range = m_blocksByHash.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    void *existing = it->second;
+    auto &block = m_blocks[existing];
+    if (block.numBytes == numBytes
+        && std::memcmp(existing, mem, numBytes) == 0) {
+      block.refs++;
+      m_bytesSaved += numBytes;
+      std::free(mem);
+      return existing;
+    }
+  }
+
+  DataBlock block;
+  block.hash = hash;
+  block.numBytes = numBytes;
+  block.refs = 1;
+  m_blocks[mem] = block;
+  m_blocksByHash.emplace(hash, mem);
+  return mem;
+}
+
+void DeduplicationCache::releaseArrayData(const void *mem)
+{
+  auto it = m_blocks.find(mem);
+  if (it == m_blocks.end())
+    return;
+
+  auto &block = it->second;
+  if (--block.refs > 0) {
+    m_bytesSaved -= block.numBytes;
+    return;
+  }
+
+  auto range = m_blocksByHash.equal_range(block.hash);
+  for (auto h = range.first; h != range.second; ++h) {
+    if (h->second == mem) {
+      m_blocksByHash.erase(h);
+      break;
+    }
+  }
+
+  m_blocks.erase(it);
+  std::free(const_cast<void *>(mem));
+}
+
+RTCScene DeduplicationCache::acquireScene(const SceneKey &key)
+{
+  const uint64_t hash = hashSceneKey(key);
+
+  auto range = m_scenesByHash.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto &entry = m_scenes[it->second];
+    if (entry.definitions == key.definitions) {
+      entry.refs++;
+      return it->second;
+    }
+  }
+
+  return nullptr;
+}
+
+void DeduplicationCache::addScene(const SceneKey &key, RTCScene scene)
+{
+  SceneEntry entry;
+  entry.hash = hashSceneKey(key);
+  entry.definitions = key.definitions;
+  entry.refs = 1;
+
+  m_scenesByHash.emplace(entry.hash, scene);
+  m_scenes[scene] = std::move(entry);
+}
+
+bool DeduplicationCache::releaseScene(RTCScene scene)
+{
+  auto it = m_scenes.find(scene);
+  if (it == m_scenes.end())
+    return false;
+
+  auto &entry = it->second;
+  if (--entry.refs > 0)
+    return true;
+
+  auto range = m_scenesByHash.equal_range(entry.hash);
+  for (auto h = range.first; h != range.second; ++h) {
+    if (h->second == scene) {
+      m_scenesByHash.erase(h);
+      break;
+    }
+  }
+
+  m_scenes.erase(it);
+  rtcReleaseScene(scene);
+  return true;
+}
+
+void DeduplicationCache::invalidateScenes()
+{
+  m_scenesByHash.clear();
+}
+
+size_t DeduplicationCache::bytesSaved() const
+{
+  return m_bytesSaved;
+}
+
+size_t DeduplicationCache::sharedSceneCount() const
+{
+  size_t count = 0;
+  for (auto &s : m_scenes)
+    count += s.second.refs - 1;
+  return count;
+}
+
+} // namespace helide
@@ -0,0 +1,83 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// embree
+#include "embree3/rtcore.h"
+
+namespace helide {
+
+uint64_t hashBytes(const void *mem, size_t numBytes, uint64_t seed = 0);
+
+// Shared storage for the opt-in content deduplication of arrays and bottom
+// level scenes (device parameter 'deduplicateData'). Array contents are
+// interned by hash + exact comparison, and so are Embree scenes by the
+// definitions of the geometries attached to them.
+struct DeduplicationCache
+{
+  ~DeduplicationCache();
+
+  // Array data //
+
+  // Return memory holding the same bytes as 'mem': either an existing block
+  // (in which case 'mem' is freed) or 'mem' itself, which is then owned by the
+  // cache. Every returned pointer must be handed back to releaseArrayData().
+  void *internArrayData(void *mem, size_t numBytes);
+  void releaseArrayData(const void *mem);
+
+  // Embree scenes //
+
+  // Definitions of the geometries attached to a scene, in attachment order,
+  // and their hashes (see Geometry::definition())
+  struct SceneKey
+  {
+    std::vector<std::string> definitions;
+    std::vector<uint64_t> hashes;
+  };
+
+  // Return an existing scene for 'key' (taking a reference), or null
+  RTCScene acquireScene(const SceneKey &key);
+  // Register a newly built scene for 'key' (cache takes the only reference)
+  void addScene(const SceneKey &key, RTCScene scene);
+  // Return false if 'scene' is not owned by the cache
+  bool releaseScene(RTCScene scene);
+  // Stop handing out existing scenes, they stay alive until released
+  void invalidateScenes();
+
+  // Statistics //
+
+  size_t bytesSaved() const;
+  size_t sharedSceneCount() const;
+
+ private:
+  struct DataBlock
+  {
+    uint64_t hash{0};
+    size_t numBytes{0};
+    size_t refs{0};
+  };
+
+  struct SceneEntry
+  {
+    uint64_t hash{0};
+    std::vector<std::string> definitions;
+    size_t refs{0};
+  };
+
+
+  std::unordered_map<const void *, DataBlock> m_blocks;
+  std::unordered_multimap<uint64_t, void *> m_blocksByHash;
+  size_t m_bytesSaved{0};
+
+  std::unordered_map<RTCScene, SceneEntry> m_scenes;
+  std::unordered_multimap<uint64_t, RTCScene> m_scenesByHash;
+};
+
+} // namespace helide
@@ -257,6 +257,20 @@ int HelideDevice::getProperty(ANARIObject object,
     } else if (prop == "helide" && type == ANARI_BOOL) {
       helium::writeToVoidP(mem, true);
       return 1;
+    } else if (prop == "deduplication.bytesSaved" && type == ANARI_UINT64) {
+      helium::writeToVoidP(
+          mem, uint64_t(deviceState()->dedupCache.bytesSaved()));
+      return 1;
+    } else if (prop == "deduplication.sharedBLSs" && type == ANARI_UINT64) {
+      helium::writeToVoidP(
+          mem, uint64_t(deviceState()->dedupCache.sharedSceneCount()));
+      return 1;
+    } else if (prop == "objectMemory.bytesInUse" && type == ANARI_UINT64) {
+      helium::writeToVoidP(mem, uint64_t(objectAllocator().bytesInUse()));
+      return 1;
+    } else if (prop == "objectMemory.bytesReserved" && type == ANARI_UINT64) {
+      helium::writeToVoidP(mem, uint64_t(objectAllocator().bytesReserved()));
+      return 1;
     }
   } else {
     if (mask == ANARI_WAIT) {
@@ -267,7 +281,7 @@ int HelideDevice::getProperty(ANARIObject object,
         name, type, mem, mask);
   }
 
-  return 0;
+  return helium::BaseDevice::getProperty(object, name, type, mem, size, mask);
 }
 
 // Frame Manipulation /////////////////////////////////////////////////////////
@@ -383,14 +397,21 @@ void HelideDevice::deviceCommitParameters()
   auto &state = *deviceState();
 
   bool allowInvalidSurfaceMaterials = state.allowInvalidSurfaceMaterials;
+  bool deduplicateData = state.deduplicateData;
+  float4 invalidMaterialColor = state.invalidMaterialColor;
 
   state.allowInvalidSurfaceMaterials =
       getParam<bool>("allowInvalidMaterials", true);
   state.invalidMaterialColor =
       getParam<float4>("invalidMaterialColor", float4(1.f, 0.f, 1.f, 1.f));
 
-  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials)
+  state.deduplicateData = getParam<bool>("deduplicateData", false);
+
+  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials
+      || deduplicateData != state.deduplicateData)
     state.objectUpdates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+  if (invalidMaterialColor != state.invalidMaterialColor)
+    state.objectUpdates.lastHitRecordsRebuildRequest = helium::newTimeStamp();
 
   helium::BaseDevice::deviceCommitParameters();
 }
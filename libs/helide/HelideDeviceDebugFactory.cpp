@@ -31,7 +31,7 @@ anari::debug_device::DebugObjectBase* new_volume(const char *name, DebugDevice *
 namespace {
 class device : public DebugObject<ANARI_DEVICE> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x6d6c0013u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f6e0028u,0x0u,0x0u,0x0u,0x0u,0x6261003cu,0x0u,0x0u,0x0u,0x0u,0x75740040u,0x6d6c0014u,0x706f0015u,0x78770016u,0x4a490017u,0x6f6e0018u,0x77760019u,0x6261001au,0x6d6c001bu,0x6a69001cu,0x6564001du,0x4e4d001eu,0x6261001fu,0x75740020u,0x66650021u,0x73720022u,0x6a690023u,0x62610024u,0x6d6c0025u,0x74730026u,0x1000027u,0x80000000u,0x77760029u,0x6261002au,0x6d6c002bu,0x6a69002cu,0x6564002du,0x4e4d002eu,0x6261002fu,0x75740030u,0x66650031u,0x73720032u,0x6a690033u,0x62610034u,0x6d6c0035u,0x44430036u,0x706f0037u,0x6d6c0038u,0x706f0039u,0x7372003au,0x100003bu,0x80000001u,0x6e6d003du,0x6665003eu,0x100003fu,0x80000002u,0x62610041u,0x75740042u,0x76750043u,0x74730044u,0x44430045u,0x62610046u,0x6d6c0047u,0x6d6c0048u,0x63620049u,0x6261004au,0x6463004bu,0x6c6b004cu,0x5600004du,0x80000003u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747300a3u,0x666500a4u,0x737200a5u,0x454400a6u,0x626100a7u,0x757400a8u,0x626100a9u,0x10000aau,0x80000004u};
+      static const uint32_t table[] = {0x6d6c0013u,0x0u,0x0u,0x66650028u,0x0u,0x0u,0x0u,0x0u,0x6f6e0037u,0x0u,0x0u,0x0u,0x0u,0x6261004bu,0x0u,0x0u,0x0u,0x0u,0x756b004fu,0x6d6c0014u,0x706f0015u,0x78770016u,0x4a490017u,0x6f6e0018u,0x77760019u,0x6261001au,0x6d6c001bu,0x6a69001cu,0x6564001du,0x4e4d001eu,0x6261001fu,0x75740020u,0x66650021u,0x73720022u,0x6a690023u,0x62610024u,0x6d6c0025u,0x74730026u,0x1000027u,0x80000000u,0x65640029u,0x7675002au,0x7170002bu,0x6d6c002cu,0x6a69002du,0x6463002eu,0x6261002fu,0x75740030u,0x66650031u,0x45440032u,0x62610033u,0x75740034u,0x62610035u,0x1000036u,0x80000002u,0x77760038u,0x62610039u,0x6d6c003au,0x6a69003bu,0x6564003cu,0x4e4d003du,0x6261003eu,0x7574003fu,0x66650040u,0x73720041u,0x6a690042u,0x62610043u,0x6d6c0044u,0x44430045u,0x706f0046u,0x6d6c0047u,0x706f0048u,0x73720049u,0x100004au,0x80000001u,0x6e6d004cu,0x6665004du,0x100004eu,0x80000005u,0x6a690059u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261006fu,0x7170005au,0x5655005bu,0x6f6e005cu,0x6463005du,0x6968005eu,0x6261005fu,0x6f6e0060u,0x68670061u,0x66650062u,0x65640063u,0x51500064u,0x62610065u,0x73720066u,0x62610067u,0x6e6d0068u,0x66650069u,0x7574006au,0x6665006bu,0x7372006cu,0x7473006du,0x100006eu,0x80000003u,0x75740070u,0x76750071u,0x74730072u,0x4e430073u,0x6261007eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900e3u,0x6d6c007fu,0x6d6c0080u,0x63620081u,0x62610082u,0x64630083u,0x6c6b0084u,0x56000085u,0x80000006u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747300dbu,0x666500dcu,0x737200ddu,0x454400deu,0x626100dfu,0x757400e0u,0x626100e1u,0x10000e2u,0x80000007u,0x6f6e00e4u,0x545300e5u,0x666500e6u,0x777600e7u,0x666500e8u,0x737200e9u,0x6a6900eau,0x757400ebu,0x7a7900ecu,0x10000edu,0x80000004u};
       uint32_t cur = 0x74610000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
@@ -68,17 +68,32 @@ class device : public DebugObject<ANARI_DEVICE> {
             check_type(ANARI_DEVICE, "", paramname, paramtype, invalidMaterialColor_types);
             return;
          }
-         case 2: { //name
+         case 2: { //deduplicateData
+            ANARIDataType deduplicateData_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_DEVICE, "", paramname, paramtype, deduplicateData_types);
+            return;
+         }
+         case 3: { //skipUnchangedParameters
+            ANARIDataType skipUnchangedParameters_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_DEVICE, "", paramname, paramtype, skipUnchangedParameters_types);
+            return;
+         }
+         case 4: { //statusMinSeverity
+            ANARIDataType statusMinSeverity_types[] = {ANARI_INT32, ANARI_UNKNOWN};
+            check_type(ANARI_DEVICE, "", paramname, paramtype, statusMinSeverity_types);
+            return;
+         }
+         case 5: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
             check_type(ANARI_DEVICE, "", paramname, paramtype, name_types);
             return;
          }
-         case 3: { //statusCallback
+         case 6: { //statusCallback
             ANARIDataType statusCallback_types[] = {ANARI_STATUS_CALLBACK, ANARI_UNKNOWN};
             check_type(ANARI_DEVICE, "", paramname, paramtype, statusCallback_types);
             return;
          }
-         case 4: { //statusCallbackUserData
+         case 7: { //statusCallbackUserData
             ANARIDataType statusCallbackUserData_types[] = {ANARI_VOID_POINTER, ANARI_UNKNOWN};
             check_type(ANARI_DEVICE, "", paramname, paramtype, statusCallbackUserData_types);
             return;
@@ -156,10 +171,10 @@ class renderer_default : public DebugObject<ANARI_RENDERER> {
       return "default";
    }
 };
-class array1d : public DebugObject<ANARI_ARRAY1D> {
+class renderer_ao : public DebugObject<ANARI_RENDERER> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x62610001u,0x6e6d0002u,0x66650003u,0x1000004u,0x80000000u};
-      uint32_t cur = 0x6f6e0000u;
+      static const uint32_t table[] = {0x706d0002u,0x62610032u,0x63620005u,0x0u,0x54440013u,0x6a690006u,0x66650007u,0x6f6e0008u,0x75740009u,0x5352000au,0x6261000bu,0x6564000cu,0x6a69000du,0x6261000eu,0x6f6e000fu,0x64630010u,0x66650011u,0x1000012u,0x80000001u,0x6a690023u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261002bu,0x74730024u,0x75740025u,0x62610026u,0x6f6e0027u,0x64630028u,0x66650029u,0x100002au,0x80000003u,0x6e6d002cu,0x7170002du,0x6d6c002eu,0x6665002fu,0x74730030u,0x1000031u,0x80000002u,0x64630033u,0x6c6b0034u,0x68670035u,0x73720036u,0x706f0037u,0x76750038u,0x6f6e0039u,0x6564003au,0x100003bu,0x80000000u};
+      uint32_t cur = 0x63610000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -180,18 +195,164 @@ class array1d : public DebugObject<ANARI_ARRAY1D> {
       return -1;
    }
    public:
-   array1d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   renderer_ao(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
+         case 0: { //background
+            ANARIDataType background_types[] = {ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            check_type(ANARI_RENDERER, "ao", paramname, paramtype, background_types);
+            return;
+         }
+         case 1: { //ambientRadiance
+            ANARIDataType ambientRadiance_types[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            check_type(ANARI_RENDERER, "ao", paramname, paramtype, ambientRadiance_types);
+            return;
+         }
+         case 2: { //aoSamples
+            ANARIDataType aoSamples_types[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            check_type(ANARI_RENDERER, "ao", paramname, paramtype, aoSamples_types);
+            return;
+         }
+         case 3: { //aoDistance
+            ANARIDataType aoDistance_types[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            check_type(ANARI_RENDERER, "ao", paramname, paramtype, aoDistance_types);
+            return;
+         }
+         default: // unknown param
+            unknown_parameter(ANARI_RENDERER, "ao", paramname, paramtype);
+            return;
+      }
+   }
+   void commit() {
+      DebugObject::commit();
+   }
+   const char* getSubtype() {
+      return "ao";
+   }
+};
+class frame : public DebugObject<ANARI_FRAME> {
+   static int param_hash(const char *str) {
+      static const uint32_t table[] = {0x69610015u,0x6665007bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610082u,0x0u,0x73690086u,0x0u,0x666500dfu,0x6a6900e7u,0x626100ebu,0x0u,0x0u,0x706f00fau,0x6e6d001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610022u,0x6665001eu,0x7372001fu,0x62610020u,0x1000021u,0x8000000cu,0x6f6e0023u,0x6f6e0024u,0x66650025u,0x6d6c0026u,0x2f2e0027u,0x77610028u,0x6d6c003eu,0x0u,0x706f0044u,0x66650049u,0x0u,0x0u,0x0u,0x0u,0x6f6e004eu,0x0u,0x0u,0x0u,0x0u,0x706f0058u,0x6362005eu,0x73720066u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690071u,0x6362003fu,0x66650040u,0x65640041u,0x706f0042u,0x1000043u,0x80000011u,0x6d6c0045u,0x706f0046u,0x73720047u,0x1000048u,0x8000000eu,0x7170004au,0x7574004bu,0x6968004cu,0x100004du,0x8000000fu,0x7473004fu,0x75740050u,0x62610051u,0x6f6e0052u,0x64630053u,0x66650054u,0x4a490055u,0x65640056u,0x1000057u,0x80000002u,0x73720059u,0x6e6d005au,0x6261005bu,0x6d6c005cu,0x100005du,0x80000010u,0x6b6a005fu,0x66650060u,0x64630061u,0x75740062u,0x4a490063u,0x65640064u,0x1000065u,0x80000001u,0x6a690067u,0x6e6d0068u,0x6a690069u,0x7574006au,0x6a69006bu,0x7776006cu,0x6665006du,0x4a49006eu,0x6564006fu,0x1000070u,0x80000000u,0x74730072u,0x6a690073u,0x63620074u,0x6a690075u,0x6d6c0076u,0x6a690077u,0x75740078u,0x7a790079u,0x100007au,0x80000003u,0x6f6e007cu,0x706f007du,0x6a69007eu,0x7473007fu,0x66650080u,0x1000081u,0x80000004u,0x6e6d0083u,0x66650084u,0x1000085u,0x80000009u,0x64630090u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f009cu,0x6c6b0091u,0x2f2e0092u,0x71700093u,0x706f0094u,0x74730095u,0x6a690096u,0x75740097u,0x6a690098u,0x706f0099u,0x6f6e009au,0x100009bu,0x80000008u,0x6867009du,0x7372009eu,0x6665009fu,0x747300a0u,0x747300a1u,0x6a6900a2u,0x777600a3u,0x666500a4u,0x2f0000a5u,0x80000006u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757400d4u,0x6a6900d5u,0x6e6d00d6u,0x666500d7u,0x434200d8u,0x767500d9u,0x656400dau,0x686700dbu,0x666500dcu,0x757400ddu,0x10000deu,0x80000007u,0x6f6e00e0u,0x656400e1u,0x666500e2u,0x737200e3u,0x666500e4u,0x737200e5u,0x10000e6u,0x8000000bu,0x7b7a00e8u,0x666500e9u,0x10000eau,0x8000000du,0x737200ecu,0x686700edu,0x666500eeu,0x757400efu,0x474600f0u,0x737200f1u,0x626100f2u,0x6e6d00f3u,0x666500f4u,0x555400f5u,0x6a6900f6u,0x6e6d00f7u,0x666500f8u,0x10000f9u,0x80000005u,0x737200fbu,0x6d6c00fcu,0x656400fdu,0x10000feu,0x8000000au};
+      uint32_t cur = 0x78630000u;
+      for(int i = 0;cur!=0;++i) {
+         uint32_t idx = cur&0xFFFFu;
+         uint32_t low = (cur>>16u)&0xFFu;
+         uint32_t high = (cur>>24u)&0xFFu;
+         uint32_t c = (uint32_t)str[i];
+         if(c>=low && c<high) {
+            cur = table[idx+c-low];
+         } else {
+            break;
+         }
+         if(cur&0x80000000u) {
+            return cur&0xFFFFu;
+         }
+         if(str[i]==0) {
+            break;
+         }
+      }
+      return -1;
+   }
+   public:
+   frame(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
+      DebugObject::setParameter(paramname, paramtype, mem);
+      int idx = param_hash(paramname);
+      switch(idx) {
+         case 0: { //channel.primitiveId
+            ANARIDataType channel_primitiveId_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_primitiveId_types);
+            return;
+         }
+         case 1: { //channel.objectId
+            ANARIDataType channel_objectId_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_objectId_types);
+            return;
+         }
+         case 2: { //channel.instanceId
+            ANARIDataType channel_instanceId_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_instanceId_types);
+            return;
+         }
+         case 3: { //channel.visibility
+            ANARIDataType channel_visibility_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_visibility_types);
+            return;
+         }
+         case 4: { //denoise
+            ANARIDataType denoise_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, denoise_types);
+            return;
+         }
+         case 5: { //targetFrameTime
+            ANARIDataType targetFrameTime_types[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, targetFrameTime_types);
+            return;
+         }
+         case 6: { //progressive
+            ANARIDataType progressive_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, progressive_types);
+            return;
+         }
+         case 7: { //progressive.timeBudget
+            ANARIDataType progressive_timeBudget_types[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, progressive_timeBudget_types);
+            return;
+         }
+         case 8: { //pick.position
+            ANARIDataType pick_position_types[] = {ANARI_FLOAT32_VEC2, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, pick_position_types);
+            return;
+         }
+         case 9: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_ARRAY1D, "", paramname, paramtype, name_types);
+            check_type(ANARI_FRAME, "", paramname, paramtype, name_types);
+            return;
+         }
+         case 10: { //world
+            ANARIDataType world_types[] = {ANARI_WORLD, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, world_types);
+            return;
+         }
+         case 11: { //renderer
+            ANARIDataType renderer_types[] = {ANARI_RENDERER, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, renderer_types);
+            return;
+         }
+         case 12: { //camera
+            ANARIDataType camera_types[] = {ANARI_CAMERA, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, camera_types);
+            return;
+         }
+         case 13: { //size
+            ANARIDataType size_types[] = {ANARI_UINT32_VEC2, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, size_types);
+            return;
+         }
+         case 14: { //channel.color
+            ANARIDataType channel_color_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_color_types);
+            return;
+         }
+         case 15: { //channel.depth
+            ANARIDataType channel_depth_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_depth_types);
+            return;
+         }
+         case 16: { //channel.normal
+            ANARIDataType channel_normal_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_normal_types);
+            return;
+         }
+         case 17: { //channel.albedo
+            ANARIDataType channel_albedo_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
+            check_type(ANARI_FRAME, "", paramname, paramtype, channel_albedo_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_ARRAY1D, "", paramname, paramtype);
+            unknown_parameter(ANARI_FRAME, "", paramname, paramtype);
             return;
       }
    }
@@ -202,10 +363,10 @@ class array1d : public DebugObject<ANARI_ARRAY1D> {
       return "";
    }
 };
-class array2d : public DebugObject<ANARI_ARRAY2D> {
+class surface : public DebugObject<ANARI_SURFACE> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x62610001u,0x6e6d0002u,0x66650003u,0x1000004u,0x80000000u};
-      uint32_t cur = 0x6f6e0000u;
+      static const uint32_t table[] = {0x66650008u,0x0u,0x65640010u,0x0u,0x0u,0x0u,0x62610012u,0x6261001au,0x706f0009u,0x6e6d000au,0x6665000bu,0x7574000cu,0x7372000du,0x7a79000eu,0x100000fu,0x80000002u,0x1000011u,0x80000000u,0x75740013u,0x66650014u,0x73720015u,0x6a690016u,0x62610017u,0x6d6c0018u,0x1000019u,0x80000003u,0x6e6d001bu,0x6665001cu,0x100001du,0x80000001u};
+      uint32_t cur = 0x6f670000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -226,18 +387,33 @@ class array2d : public DebugObject<ANARI_ARRAY2D> {
       return -1;
    }
    public:
-   array2d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   surface(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
+         case 0: { //id
+            ANARIDataType id_types[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            check_type(ANARI_SURFACE, "", paramname, paramtype, id_types);
+            return;
+         }
+         case 1: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_ARRAY2D, "", paramname, paramtype, name_types);
+            check_type(ANARI_SURFACE, "", paramname, paramtype, name_types);
+            return;
+         }
+         case 2: { //geometry
+            ANARIDataType geometry_types[] = {ANARI_GEOMETRY, ANARI_UNKNOWN};
+            check_type(ANARI_SURFACE, "", paramname, paramtype, geometry_types);
+            return;
+         }
+         case 3: { //material
+            ANARIDataType material_types[] = {ANARI_MATERIAL, ANARI_UNKNOWN};
+            check_type(ANARI_SURFACE, "", paramname, paramtype, material_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_ARRAY2D, "", paramname, paramtype);
+            unknown_parameter(ANARI_SURFACE, "", paramname, paramtype);
             return;
       }
    }
@@ -248,10 +424,10 @@ class array2d : public DebugObject<ANARI_ARRAY2D> {
       return "";
    }
 };
-class array3d : public DebugObject<ANARI_ARRAY3D> {
+class instance : public DebugObject<ANARI_INSTANCE> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x62610001u,0x6e6d0002u,0x66650003u,0x1000004u,0x80000000u};
-      uint32_t cur = 0x6f6e0000u;
+      static const uint32_t table[] = {0x7372000eu,0x0u,0x65640013u,0x0u,0x0u,0x0u,0x0u,0x62610015u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720019u,0x706f000fu,0x76750010u,0x71700011u,0x1000012u,0x80000003u,0x1000014u,0x80000000u,0x6e6d0016u,0x66650017u,0x1000018u,0x80000001u,0x6261001au,0x6f6e001bu,0x7473001cu,0x6766001du,0x706f001eu,0x7372001fu,0x6e6d0020u,0x1000021u,0x80000002u};
+      uint32_t cur = 0x75670000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -272,18 +448,33 @@ class array3d : public DebugObject<ANARI_ARRAY3D> {
       return -1;
    }
    public:
-   array3d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   instance(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
+         case 0: { //id
+            ANARIDataType id_types[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            check_type(ANARI_INSTANCE, "", paramname, paramtype, id_types);
+            return;
+         }
+         case 1: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_ARRAY3D, "", paramname, paramtype, name_types);
+            check_type(ANARI_INSTANCE, "", paramname, paramtype, name_types);
+            return;
+         }
+         case 2: { //transform
+            ANARIDataType transform_types[] = {ANARI_FLOAT32_MAT4, ANARI_UNKNOWN};
+            check_type(ANARI_INSTANCE, "", paramname, paramtype, transform_types);
+            return;
+         }
+         case 3: { //group
+            ANARIDataType group_types[] = {ANARI_GROUP, ANARI_UNKNOWN};
+            check_type(ANARI_INSTANCE, "", paramname, paramtype, group_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_ARRAY3D, "", paramname, paramtype);
+            unknown_parameter(ANARI_INSTANCE, "", paramname, paramtype);
             return;
       }
    }
@@ -294,10 +485,10 @@ class array3d : public DebugObject<ANARI_ARRAY3D> {
       return "";
    }
 };
-class frame : public DebugObject<ANARI_FRAME> {
+class array1d : public DebugObject<ANARI_ARRAY1D> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x69610015u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610034u,0x0u,0x0u,0x0u,0x66650038u,0x6a690040u,0x0u,0x0u,0x0u,0x706f0044u,0x6e6d001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610022u,0x6665001eu,0x7372001fu,0x62610020u,0x1000021u,0x80000003u,0x6f6e0023u,0x6f6e0024u,0x66650025u,0x6d6c0026u,0x2f2e0027u,0x65630028u,0x706f002au,0x6665002fu,0x6d6c002bu,0x706f002cu,0x7372002du,0x100002eu,0x80000005u,0x71700030u,0x75740031u,0x69680032u,0x1000033u,0x80000006u,0x6e6d0035u,0x66650036u,0x1000037u,0x80000000u,0x6f6e0039u,0x6564003au,0x6665003bu,0x7372003cu,0x6665003du,0x7372003eu,0x100003fu,0x80000002u,0x7b7a0041u,0x66650042u,0x1000043u,0x80000004u,0x73720045u,0x6d6c0046u,0x65640047u,0x1000048u,0x80000001u};
-      uint32_t cur = 0x78630000u;
+      static const uint32_t table[] = {0x6a69000fu,0x0u,0x6a69001au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610073u,0x0u,0x0u,0x0u,0x66650077u,0x73720010u,0x75740011u,0x7a790012u,0x53520013u,0x66650014u,0x68670015u,0x6a690016u,0x706f0017u,0x6f6e0018u,0x1000019u,0x80000005u,0x6d6c001bu,0x6665001cu,0x5000001du,0x80000003u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6766006du,0x6766006eu,0x7473006fu,0x66650070u,0x75740071u,0x1000072u,0x80000004u,0x6e6d0074u,0x66650075u,0x1000076u,0x80000006u,0x6d610078u,0x65640084u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665008au,0x504f0085u,0x6f6e0086u,0x6d6c0087u,0x7a790088u,0x1000089u,0x80000000u,0x6261008bu,0x7473008cu,0x6665008du,0x4544008eu,0x6665008fu,0x6d6c0090u,0x66650091u,0x75740092u,0x66650093u,0x73720094u,0x56000095u,0x80000001u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747300ebu,0x666500ecu,0x737200edu,0x454400eeu,0x626100efu,0x757400f0u,0x626100f1u,0x10000f2u,0x80000002u};
+      uint32_t cur = 0x73640000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -318,48 +509,48 @@ class frame : public DebugObject<ANARI_FRAME> {
       return -1;
    }
    public:
-   frame(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   array1d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
-            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, name_types);
+         case 0: { //readOnly
+            ANARIDataType readOnly_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, readOnly_types);
             return;
          }
-         case 1: { //world
-            ANARIDataType world_types[] = {ANARI_WORLD, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, world_types);
+         case 1: { //releaseDeleter
+            ANARIDataType releaseDeleter_types[] = {ANARI_MEMORY_DELETER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, releaseDeleter_types);
             return;
          }
-         case 2: { //renderer
-            ANARIDataType renderer_types[] = {ANARI_RENDERER, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, renderer_types);
+         case 2: { //releaseDeleterUserData
+            ANARIDataType releaseDeleterUserData_types[] = {ANARI_VOID_POINTER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, releaseDeleterUserData_types);
             return;
          }
-         case 3: { //camera
-            ANARIDataType camera_types[] = {ANARI_CAMERA, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, camera_types);
+         case 3: { //file
+            ANARIDataType file_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, file_types);
             return;
          }
-         case 4: { //size
-            ANARIDataType size_types[] = {ANARI_UINT32_VEC2, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, size_types);
+         case 4: { //fileOffset
+            ANARIDataType fileOffset_types[] = {ANARI_UINT64, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, fileOffset_types);
             return;
          }
-         case 5: { //channel.color
-            ANARIDataType channel_color_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, channel_color_types);
+         case 5: { //dirtyRegion
+            ANARIDataType dirtyRegion_types[] = {ANARI_UINT64_REGION1, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, dirtyRegion_types);
             return;
          }
-         case 6: { //channel.depth
-            ANARIDataType channel_depth_types[] = {ANARI_DATA_TYPE, ANARI_UNKNOWN};
-            check_type(ANARI_FRAME, "", paramname, paramtype, channel_depth_types);
+         case 6: { //name
+            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY1D, "", paramname, paramtype, name_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_FRAME, "", paramname, paramtype);
+            unknown_parameter(ANARI_ARRAY1D, "", paramname, paramtype);
             return;
       }
    }
@@ -370,10 +561,10 @@ class frame : public DebugObject<ANARI_FRAME> {
       return "";
    }
 };
-class group : public DebugObject<ANARI_GROUP> {
+class array2d : public DebugObject<ANARI_ARRAY2D> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x6a69000bu,0x0u,0x62610010u,0x0u,0x0u,0x0u,0x0u,0x76750014u,0x0u,0x0u,0x706f001bu,0x6867000cu,0x6968000du,0x7574000eu,0x100000fu,0x80000003u,0x6e6d0011u,0x66650012u,0x1000013u,0x80000000u,0x73720015u,0x67660016u,0x62610017u,0x64630018u,0x66650019u,0x100001au,0x80000001u,0x6d6c001cu,0x7675001du,0x6e6d001eu,0x6665001fu,0x1000020u,0x80000002u};
-      uint32_t cur = 0x776c0000u;
+      static const uint32_t table[] = {0x6a69000fu,0x0u,0x6a69001au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610073u,0x0u,0x0u,0x0u,0x66650077u,0x73720010u,0x75740011u,0x7a790012u,0x53520013u,0x66650014u,0x68670015u,0x6a690016u,0x706f0017u,0x6f6e0018u,0x1000019u,0x80000005u,0x6d6c001bu,0x6665001cu,0x5000001du,0x80000003u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6766006du,0x6766006eu,0x7473006fu,0x66650070u,0x75740071u,0x1000072u,0x80000004u,0x6e6d0074u,0x66650075u,0x1000076u,0x80000006u,0x6d610078u,0x65640084u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665008au,0x504f0085u,0x6f6e0086u,0x6d6c0087u,0x7a790088u,0x1000089u,0x80000000u,0x6261008bu,0x7473008cu,0x6665008du,0x4544008eu,0x6665008fu,0x6d6c0090u,0x66650091u,0x75740092u,0x66650093u,0x73720094u,0x56000095u,0x80000001u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747300ebu,0x666500ecu,0x737200edu,0x454400eeu,0x626100efu,0x757400f0u,0x626100f1u,0x10000f2u,0x80000002u};
+      uint32_t cur = 0x73640000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -394,33 +585,48 @@ class group : public DebugObject<ANARI_GROUP> {
       return -1;
    }
    public:
-   group(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   array2d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
-            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_GROUP, "", paramname, paramtype, name_types);
+         case 0: { //readOnly
+            ANARIDataType readOnly_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, readOnly_types);
             return;
          }
-         case 1: { //surface
-            ANARIDataType surface_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_GROUP, "", paramname, paramtype, surface_types);
+         case 1: { //releaseDeleter
+            ANARIDataType releaseDeleter_types[] = {ANARI_MEMORY_DELETER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, releaseDeleter_types);
             return;
          }
-         case 2: { //volume
-            ANARIDataType volume_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_GROUP, "", paramname, paramtype, volume_types);
+         case 2: { //releaseDeleterUserData
+            ANARIDataType releaseDeleterUserData_types[] = {ANARI_VOID_POINTER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, releaseDeleterUserData_types);
             return;
          }
-         case 3: { //light
-            ANARIDataType light_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_GROUP, "", paramname, paramtype, light_types);
+         case 3: { //file
+            ANARIDataType file_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, file_types);
+            return;
+         }
+         case 4: { //fileOffset
+            ANARIDataType fileOffset_types[] = {ANARI_UINT64, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, fileOffset_types);
+            return;
+         }
+         case 5: { //dirtyRegion
+            ANARIDataType dirtyRegion_types[] = {ANARI_UINT64_REGION1, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, dirtyRegion_types);
+            return;
+         }
+         case 6: { //name
+            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY2D, "", paramname, paramtype, name_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_GROUP, "", paramname, paramtype);
+            unknown_parameter(ANARI_ARRAY2D, "", paramname, paramtype);
             return;
       }
    }
@@ -431,10 +637,10 @@ class group : public DebugObject<ANARI_GROUP> {
       return "";
    }
 };
-class instance : public DebugObject<ANARI_INSTANCE> {
+class array3d : public DebugObject<ANARI_ARRAY3D> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x7372000eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610013u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720017u,0x706f000fu,0x76750010u,0x71700011u,0x1000012u,0x80000002u,0x6e6d0014u,0x66650015u,0x1000016u,0x80000000u,0x62610018u,0x6f6e0019u,0x7473001au,0x6766001bu,0x706f001cu,0x7372001du,0x6e6d001eu,0x100001fu,0x80000001u};
-      uint32_t cur = 0x75670000u;
+      static const uint32_t table[] = {0x6a69000fu,0x0u,0x6a69001au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610073u,0x0u,0x0u,0x0u,0x66650077u,0x73720010u,0x75740011u,0x7a790012u,0x53520013u,0x66650014u,0x68670015u,0x6a690016u,0x706f0017u,0x6f6e0018u,0x1000019u,0x80000005u,0x6d6c001bu,0x6665001cu,0x5000001du,0x80000003u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6766006du,0x6766006eu,0x7473006fu,0x66650070u,0x75740071u,0x1000072u,0x80000004u,0x6e6d0074u,0x66650075u,0x1000076u,0x80000006u,0x6d610078u,0x65640084u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665008au,0x504f0085u,0x6f6e0086u,0x6d6c0087u,0x7a790088u,0x1000089u,0x80000000u,0x6261008bu,0x7473008cu,0x6665008du,0x4544008eu,0x6665008fu,0x6d6c0090u,0x66650091u,0x75740092u,0x66650093u,0x73720094u,0x56000095u,0x80000001u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747300ebu,0x666500ecu,0x737200edu,0x454400eeu,0x626100efu,0x757400f0u,0x626100f1u,0x10000f2u,0x80000002u};
+      uint32_t cur = 0x73640000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -455,28 +661,48 @@ class instance : public DebugObject<ANARI_INSTANCE> {
       return -1;
    }
    public:
-   instance(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   array3d(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
-         case 0: { //name
-            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_INSTANCE, "", paramname, paramtype, name_types);
+         case 0: { //readOnly
+            ANARIDataType readOnly_types[] = {ANARI_BOOL, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, readOnly_types);
             return;
          }
-         case 1: { //transform
-            ANARIDataType transform_types[] = {ANARI_FLOAT32_MAT4, ANARI_UNKNOWN};
-            check_type(ANARI_INSTANCE, "", paramname, paramtype, transform_types);
+         case 1: { //releaseDeleter
+            ANARIDataType releaseDeleter_types[] = {ANARI_MEMORY_DELETER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, releaseDeleter_types);
             return;
          }
-         case 2: { //group
-            ANARIDataType group_types[] = {ANARI_GROUP, ANARI_UNKNOWN};
-            check_type(ANARI_INSTANCE, "", paramname, paramtype, group_types);
+         case 2: { //releaseDeleterUserData
+            ANARIDataType releaseDeleterUserData_types[] = {ANARI_VOID_POINTER, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, releaseDeleterUserData_types);
+            return;
+         }
+         case 3: { //file
+            ANARIDataType file_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, file_types);
+            return;
+         }
+         case 4: { //fileOffset
+            ANARIDataType fileOffset_types[] = {ANARI_UINT64, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, fileOffset_types);
+            return;
+         }
+         case 5: { //dirtyRegion
+            ANARIDataType dirtyRegion_types[] = {ANARI_UINT64_REGION1, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, dirtyRegion_types);
+            return;
+         }
+         case 6: { //name
+            ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
+            check_type(ANARI_ARRAY3D, "", paramname, paramtype, name_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_INSTANCE, "", paramname, paramtype);
+            unknown_parameter(ANARI_ARRAY3D, "", paramname, paramtype);
             return;
       }
    }
@@ -487,10 +713,10 @@ class instance : public DebugObject<ANARI_INSTANCE> {
       return "";
    }
 };
-class world : public DebugObject<ANARI_WORLD> {
+class group : public DebugObject<ANARI_GROUP> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x6f6e000eu,0x0u,0x0u,0x6a690016u,0x0u,0x6261001bu,0x0u,0x0u,0x0u,0x0u,0x7675001fu,0x0u,0x0u,0x706f0026u,0x7473000fu,0x75740010u,0x62610011u,0x6f6e0012u,0x64630013u,0x66650014u,0x1000015u,0x80000001u,0x68670017u,0x69680018u,0x75740019u,0x100001au,0x80000004u,0x6e6d001cu,0x6665001du,0x100001eu,0x80000000u,0x73720020u,0x67660021u,0x62610022u,0x64630023u,0x66650024u,0x1000025u,0x80000002u,0x6d6c0027u,0x76750028u,0x6e6d0029u,0x6665002au,0x100002bu,0x80000003u};
-      uint32_t cur = 0x77690000u;
+      static const uint32_t table[] = {0x6a69000bu,0x0u,0x62610010u,0x0u,0x0u,0x0u,0x0u,0x76750014u,0x0u,0x0u,0x706f001bu,0x6867000cu,0x6968000du,0x7574000eu,0x100000fu,0x80000003u,0x6e6d0011u,0x66650012u,0x1000013u,0x80000000u,0x73720015u,0x67660016u,0x62610017u,0x64630018u,0x66650019u,0x100001au,0x80000001u,0x6d6c001cu,0x7675001du,0x6e6d001eu,0x6665001fu,0x1000020u,0x80000002u};
+      uint32_t cur = 0x776c0000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -511,38 +737,33 @@ class world : public DebugObject<ANARI_WORLD> {
       return -1;
    }
    public:
-   world(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   group(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
          case 0: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_WORLD, "", paramname, paramtype, name_types);
-            return;
-         }
-         case 1: { //instance
-            ANARIDataType instance_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_WORLD, "", paramname, paramtype, instance_types);
+            check_type(ANARI_GROUP, "", paramname, paramtype, name_types);
             return;
          }
-         case 2: { //surface
+         case 1: { //surface
             ANARIDataType surface_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_WORLD, "", paramname, paramtype, surface_types);
+            check_type(ANARI_GROUP, "", paramname, paramtype, surface_types);
             return;
          }
-         case 3: { //volume
+         case 2: { //volume
             ANARIDataType volume_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_WORLD, "", paramname, paramtype, volume_types);
+            check_type(ANARI_GROUP, "", paramname, paramtype, volume_types);
             return;
          }
-         case 4: { //light
+         case 3: { //light
             ANARIDataType light_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
-            check_type(ANARI_WORLD, "", paramname, paramtype, light_types);
+            check_type(ANARI_GROUP, "", paramname, paramtype, light_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_WORLD, "", paramname, paramtype);
+            unknown_parameter(ANARI_GROUP, "", paramname, paramtype);
             return;
       }
    }
@@ -553,10 +774,10 @@ class world : public DebugObject<ANARI_WORLD> {
       return "";
    }
 };
-class surface : public DebugObject<ANARI_SURFACE> {
+class world : public DebugObject<ANARI_WORLD> {
    static int param_hash(const char *str) {
-      static const uint32_t table[] = {0x66650008u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610010u,0x62610018u,0x706f0009u,0x6e6d000au,0x6665000bu,0x7574000cu,0x7372000du,0x7a79000eu,0x100000fu,0x80000001u,0x75740011u,0x66650012u,0x73720013u,0x6a690014u,0x62610015u,0x6d6c0016u,0x1000017u,0x80000002u,0x6e6d0019u,0x6665001au,0x100001bu,0x80000000u};
-      uint32_t cur = 0x6f670000u;
+      static const uint32_t table[] = {0x6f6e000eu,0x0u,0x0u,0x6a690016u,0x0u,0x6261001bu,0x0u,0x0u,0x0u,0x0u,0x7675001fu,0x0u,0x0u,0x706f0026u,0x7473000fu,0x75740010u,0x62610011u,0x6f6e0012u,0x64630013u,0x66650014u,0x1000015u,0x80000001u,0x68670017u,0x69680018u,0x75740019u,0x100001au,0x80000004u,0x6e6d001cu,0x6665001du,0x100001eu,0x80000000u,0x73720020u,0x67660021u,0x62610022u,0x64630023u,0x66650024u,0x1000025u,0x80000002u,0x6d6c0027u,0x76750028u,0x6e6d0029u,0x6665002au,0x100002bu,0x80000003u};
+      uint32_t cur = 0x77690000u;
       for(int i = 0;cur!=0;++i) {
          uint32_t idx = cur&0xFFFFu;
          uint32_t low = (cur>>16u)&0xFFu;
@@ -577,28 +798,38 @@ class surface : public DebugObject<ANARI_SURFACE> {
       return -1;
    }
    public:
-   surface(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
+   world(DebugDevice *td, HelideDeviceDebugFactory *factory, ANARIObject wh, ANARIObject h): DebugObject(td, wh, h) { (void)factory; }
    void setParameter(const char *paramname, ANARIDataType paramtype, const void *mem) {
       DebugObject::setParameter(paramname, paramtype, mem);
       int idx = param_hash(paramname);
       switch(idx) {
          case 0: { //name
             ANARIDataType name_types[] = {ANARI_STRING, ANARI_UNKNOWN};
-            check_type(ANARI_SURFACE, "", paramname, paramtype, name_types);
+            check_type(ANARI_WORLD, "", paramname, paramtype, name_types);
             return;
          }
-         case 1: { //geometry
-            ANARIDataType geometry_types[] = {ANARI_GEOMETRY, ANARI_UNKNOWN};
-            check_type(ANARI_SURFACE, "", paramname, paramtype, geometry_types);
+         case 1: { //instance
+            ANARIDataType instance_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
+            check_type(ANARI_WORLD, "", paramname, paramtype, instance_types);
             return;
          }
-         case 2: { //material
-            ANARIDataType material_types[] = {ANARI_MATERIAL, ANARI_UNKNOWN};
-            check_type(ANARI_SURFACE, "", paramname, paramtype, material_types);
+         case 2: { //surface
+            ANARIDataType surface_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
+            check_type(ANARI_WORLD, "", paramname, paramtype, surface_types);
+            return;
+         }
+         case 3: { //volume
+            ANARIDataType volume_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
+            check_type(ANARI_WORLD, "", paramname, paramtype, volume_types);
+            return;
+         }
+         case 4: { //light
+            ANARIDataType light_types[] = {ANARI_ARRAY1D, ANARI_UNKNOWN};
+            check_type(ANARI_WORLD, "", paramname, paramtype, light_types);
             return;
          }
          default: // unknown param
-            unknown_parameter(ANARI_SURFACE, "", paramname, paramtype);
+            unknown_parameter(ANARI_WORLD, "", paramname, paramtype);
             return;
       }
    }
@@ -2285,8 +2516,8 @@ DebugObjectBase* HelideDeviceDebugFactory::new_material(const char *name, DebugD
    }
 }
 static int renderer_object_hash(const char *str) {
-   static const uint32_t table[] = {0x66650001u,0x67660002u,0x62610003u,0x76750004u,0x6d6c0005u,0x75740006u,0x1000007u,0x80000000u};
-   uint32_t cur = 0x65640000u;
+   static const uint32_t table[] = {0x706f0004u,0x0u,0x0u,0x66650006u,0x1000005u,0x80000000u,0x67660007u,0x62610008u,0x76750009u,0x6d6c000au,0x7574000bu,0x100000cu,0x80000001u};
+   uint32_t cur = 0x65610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
       uint32_t low = (cur>>16u)&0xFFu;
@@ -2310,6 +2541,8 @@ DebugObjectBase* HelideDeviceDebugFactory::new_renderer(const char *name, DebugD
    int idx = renderer_object_hash(name);
    switch(idx) {
       case 0:
+         return new renderer_ao(td, this, wh, h);
+      case 1:
          return new renderer_default(td, this, wh, h);
       default:
          unknown_subtype(td, ANARI_RENDERER, name);
@@ -9,8 +9,8 @@
 #include <anari/anari.h>
 namespace helide {
 static int subtype_hash(const char *str) {
-   static const uint32_t table[] = {0x7a6f0012u,0x6665002bu,0x0u,0x0u,0x0u,0x0u,0x6e6d0032u,0x0u,0x0u,0x0u,0x6261003fu,0x0u,0x73720044u,0x73650050u,0x76750070u,0x0u,0x75700074u,0x7372008eu,0x6f6e001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720020u,0x0u,0x0u,0x0u,0x6d6c0024u,0x6665001eu,0x100001fu,0x80000000u,0x77760021u,0x66650022u,0x1000023u,0x80000001u,0x6a690025u,0x6f6e0026u,0x65640027u,0x66650028u,0x73720029u,0x100002au,0x80000002u,0x6766002cu,0x6261002du,0x7675002eu,0x6d6c002fu,0x75740030u,0x1000031u,0x80000003u,0x62610033u,0x68670034u,0x66650035u,0x34310036u,0x45440039u,0x4544003bu,0x4544003du,0x100003au,0x80000004u,0x100003cu,0x80000005u,0x100003eu,0x80000006u,0x75740040u,0x75740041u,0x66650042u,0x1000043u,0x80000007u,0x75740045u,0x69680046u,0x706f0047u,0x68670048u,0x73720049u,0x6261004au,0x7170004bu,0x6968004cu,0x6a69004du,0x6463004eu,0x100004fu,0x80000008u,0x7372005eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690068u,0x7473005fu,0x71700060u,0x66650061u,0x64630062u,0x75740063u,0x6a690064u,0x77760065u,0x66650066u,0x1000067u,0x80000009u,0x6e6d0069u,0x6a69006au,0x7574006bu,0x6a69006cu,0x7776006du,0x6665006eu,0x100006fu,0x8000000au,0x62610071u,0x65640072u,0x1000073u,0x8000000bu,0x69680079u,0x0u,0x0u,0x0u,0x7372007eu,0x6665007au,0x7372007bu,0x6665007cu,0x100007du,0x8000000cu,0x7675007fu,0x64630080u,0x75740081u,0x76750082u,0x73720083u,0x66650084u,0x65640085u,0x53520086u,0x66650087u,0x68670088u,0x76750089u,0x6d6c008au,0x6261008bu,0x7372008cu,0x100008du,0x8000000du,0x6a61008fu,0x6f6e0098u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100b5u,0x74730099u,0x6766009au,0x7065009bu,0x737200a6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200b2u,0x474600a7u,0x767500a8u,0x6f6e00a9u,0x646300aau,0x757400abu,0x6a6900acu,0x706f00adu,0x6f6e00aeu,0x323100afu,0x454400b0u,0x10000b1u,0x8000000eu,0x6e6d00b3u,0x10000b4u,0x8000000fu,0x6f6e00b6u,0x686700b7u,0x6d6c00b8u,0x666500b9u,0x10000bau,0x80000010u};
-   uint32_t cur = 0x75630000u;
+   static const uint32_t table[] = {0x706f0014u,0x0u,0x7a6f0016u,0x6665002fu,0x0u,0x0u,0x0u,0x0u,0x6e6d0036u,0x0u,0x0u,0x0u,0x62610043u,0x0u,0x73720048u,0x73650054u,0x76750074u,0x0u,0x75700078u,0x73720092u,0x1000015u,0x80000000u,0x6f6e0021u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720024u,0x0u,0x0u,0x0u,0x6d6c0028u,0x66650022u,0x1000023u,0x80000001u,0x77760025u,0x66650026u,0x1000027u,0x80000002u,0x6a690029u,0x6f6e002au,0x6564002bu,0x6665002cu,0x7372002du,0x100002eu,0x80000003u,0x67660030u,0x62610031u,0x76750032u,0x6d6c0033u,0x75740034u,0x1000035u,0x80000004u,0x62610037u,0x68670038u,0x66650039u,0x3431003au,0x4544003du,0x4544003fu,0x45440041u,0x100003eu,0x80000005u,0x1000040u,0x80000006u,0x1000042u,0x80000007u,0x75740044u,0x75740045u,0x66650046u,0x1000047u,0x80000008u,0x75740049u,0x6968004au,0x706f004bu,0x6867004cu,0x7372004du,0x6261004eu,0x7170004fu,0x69680050u,0x6a690051u,0x64630052u,0x1000053u,0x80000009u,0x73720062u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69006cu,0x74730063u,0x71700064u,0x66650065u,0x64630066u,0x75740067u,0x6a690068u,0x77760069u,0x6665006au,0x100006bu,0x8000000au,0x6e6d006du,0x6a69006eu,0x7574006fu,0x6a690070u,0x77760071u,0x66650072u,0x1000073u,0x8000000bu,0x62610075u,0x65640076u,0x1000077u,0x8000000cu,0x6968007du,0x0u,0x0u,0x0u,0x73720082u,0x6665007eu,0x7372007fu,0x66650080u,0x1000081u,0x8000000du,0x76750083u,0x64630084u,0x75740085u,0x76750086u,0x73720087u,0x66650088u,0x65640089u,0x5352008au,0x6665008bu,0x6867008cu,0x7675008du,0x6d6c008eu,0x6261008fu,0x73720090u,0x1000091u,0x8000000eu,0x6a610093u,0x6f6e009cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100b9u,0x7473009du,0x6766009eu,0x7065009fu,0x737200aau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200b6u,0x474600abu,0x767500acu,0x6f6e00adu,0x646300aeu,0x757400afu,0x6a6900b0u,0x706f00b1u,0x6f6e00b2u,0x323100b3u,0x454400b4u,0x10000b5u,0x8000000fu,0x6e6d00b7u,0x10000b8u,0x80000010u,0x6f6e00bau,0x686700bbu,0x6d6c00bcu,0x666500bdu,0x10000beu,0x80000011u};
+   uint32_t cur = 0x75610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
       uint32_t low = (cur>>16u)&0xFFu;
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x746c0017u,0x62610072u,0x7061007cu,0x6a6100e2u,0x0u,0x70610101u,0x73650142u,0x6665015bu,0x6f6d0161u,0x0u,0x0u,0x6a690239u,0x7061023eu,0x66610257u,0x76700262u,0x736f02c0u,0x0u,0x66610310u,0x76690321u,0x737203b3u,0x717003bcu,0x706103beu,0x736f0434u,0x716c001fu,0x6362004eu,0x0u,0x0u,0x6665005cu,0x0u,0x73720069u,0x7170006du,0x706f0024u,0x0u,0x0u,0x0u,0x69680037u,0x78770025u,0x4a490026u,0x6f6e0027u,0x77760028u,0x62610029u,0x6d6c002au,0x6a69002bu,0x6564002cu,0x4e4d002du,0x6261002eu,0x7574002fu,0x66650030u,0x73720031u,0x6a690032u,0x62610033u,0x6d6c0034u,0x74730035u,0x1000036u,0x80000000u,0x62610038u,0x4e430039u,0x76750044u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004au,0x75740045u,0x706f0046u,0x67660047u,0x67660048u,0x1000049u,0x80000001u,0x6564004bu,0x6665004cu,0x100004du,0x80000002u,0x6a69004fu,0x66650050u,0x6f6e0051u,0x75740052u,0x53520053u,0x62610054u,0x65640055u,0x6a690056u,0x62610057u,0x6f6e0058u,0x64630059u,0x6665005au,0x100005bu,0x80000003u,0x7372005du,0x7574005eu,0x7675005fu,0x73720060u,0x66650061u,0x53520062u,0x62610063u,0x65640064u,0x6a690065u,0x76750066u,0x74730067u,0x1000068u,0x80000004u,0x6261006au,0x7a79006bu,0x100006cu,0x80000005u,0x6665006eu,0x6463006fu,0x75740070u,0x1000071u,0x80000006u,0x64630073u,0x6c6b0074u,0x68670075u,0x73720076u,0x706f0077u,0x76750078u,0x6f6e0079u,0x6564007au,0x100007bu,0x80000007u,0x716d008bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610095u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00a7u,0x6665008fu,0x0u,0x0u,0x74730093u,0x73720090u,0x62610091u,0x1000092u,0x80000008u,0x1000094u,0x80000009u,0x6f6e0096u,0x6f6e0097u,0x66650098u,0x6d6c0099u,0x2f2e009au,0x6563009bu,0x706f009du,0x666500a2u,0x6d6c009eu,0x706f009fu,0x737200a0u,0x10000a1u,0x8000000au,0x717000a3u,0x757400a4u,0x696800a5u,0x10000a6u,0x8000000bu,0x706f00a8u,0x737200a9u,0x2f0000aau,0x8000000cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x717000d9u,0x706f00dau,0x747300dbu,0x6a6900dcu,0x757400ddu,0x6a6900deu,0x706f00dfu,0x6f6e00e0u,0x10000e1u,0x8000000du,0x757400ebu,0x0u,0x0u,0x0u,0x6f6e00eeu,0x0u,0x0u,0x0u,0x737200f9u,0x626100ecu,0x10000edu,0x8000000eu,0x747300efu,0x6a6900f0u,0x757400f1u,0x7a7900f2u,0x545300f3u,0x646300f4u,0x626100f5u,0x6d6c00f6u,0x666500f7u,0x10000f8u,0x8000000fu,0x666500fau,0x646300fbu,0x757400fcu,0x6a6900fdu,0x706f00feu,0x6f6e00ffu,0x1000100u,0x80000010u,0x73720110u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d650112u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77630121u,0x1000111u,0x80000011u,0x6d6c011au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7574011du,0x6564011bu,0x100011cu,0x80000012u,0x6665011eu,0x7372011fu,0x1000120u,0x80000013u,0x76750135u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a790140u,0x74730136u,0x45440137u,0x6a690138u,0x74730139u,0x7574013au,0x6261013bu,0x6f6e013cu,0x6463013du,0x6665013eu,0x100013fu,0x80000014u,0x1000141u,0x80000015u,0x706f0150u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0157u,0x6e6d0151u,0x66650152u,0x75740153u,0x73720154u,0x7a790155u,0x1000156u,0x80000016u,0x76750158u,0x71700159u,0x100015au,0x80000017u,0x6a69015cu,0x6867015du,0x6968015eu,0x7574015fu,0x1000160u,0x80000018u,0x62610163u,0x774101bfu,0x68670164u,0x66650165u,0x53000166u,0x80000019u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666501b9u,0x686701bau,0x6a6901bbu,0x706f01bcu,0x6f6e01bdu,0x10001beu,0x8000001au,0x757401f5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676601feu,0x0u,0x0u,0x0u,0x0u,0x73720204u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7574020du,0x66650213u,0x0u,0x62610227u,0x757401f6u,0x737201f7u,0x6a6901f8u,0x636201f9u,0x767501fau,0x757401fbu,0x666501fcu,0x10001fdu,0x8000001bu,0x676601ffu,0x74730200u,0x66650201u,0x75740202u,0x1000203u,0x8000001cu,0x62610205u,0x6f6e0206u,0x74730207u,0x67660208u,0x706f0209u,0x7372020au,0x6e6d020bu,0x100020cu,0x8000001du,0x6261020eu,0x6f6e020fu,0x64630210u,0x66650211u,0x1000212u,0x8000001eu,0x73720214u,0x71700215u,0x76750216u,0x71700217u,0x6a690218u,0x6d6c0219u,0x6d6c021au,0x6261021bu,0x7372021cu,0x7a79021du,0x4544021eu,0x6a69021fu,0x74730220u,0x75740221u,0x62610222u,0x6f6e0223u,0x64630224u,0x66650225u,0x1000226u,0x8000001fu,0x6d6c0228u,0x6a690229u,0x6564022au,0x4e4d022bu,0x6261022cu,0x7574022du,0x6665022eu,0x7372022fu,0x6a690230u,0x62610231u,0x6d6c0232u,0x44430233u,0x706f0234u,0x6d6c0235u,0x706f0236u,0x73720237u,0x1000238u,0x80000020u,0x6867023au,0x6968023bu,0x7574023cu,0x100023du,0x80000021u,0x7574024du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640254u,0x6665024eu,0x7372024fu,0x6a690250u,0x62610251u,0x6d6c0252u,0x1000253u,0x80000022u,0x66650255u,0x1000256u,0x80000023u,0x6e6d025cu,0x0u,0x0u,0x0u,0x6261025fu,0x6665025du,0x100025eu,0x80000024u,0x73720260u,0x1000261u,0x80000025u,0x62610268u,0x0u,0x6a6902a5u,0x0u,0x0u,0x757402aau,0x64630269u,0x6a69026au,0x7574026bu,0x7a79026cu,0x2f00026du,0x80000026u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7170029cu,0x706f029du,0x7473029eu,0x6a69029fu,0x757402a0u,0x6a6902a1u,0x706f02a2u,0x6f6e02a3u,0x10002a4u,0x80000027u,0x686702a6u,0x6a6902a7u,0x6f6e02a8u,0x10002a9u,0x80000028u,0x554f02abu,0x676602b1u,0x0u,0x0u,0x0u,0x0u,0x737202b7u,0x676602b2u,0x747302b3u,0x666502b4u,0x757402b5u,0x10002b6u,0x80000029u,0x626102b8u,0x6f6e02b9u,0x747302bau,0x676602bbu,0x706f02bcu,0x737202bdu,0x6e6d02beu,0x10002bfu,0x8000002au,0x747302c4u,0x0u,0x0u,0x6a6902cbu,0x6a6902c5u,0x757402c6u,0x6a6902c7u,0x706f02c8u,0x6f6e02c9u,0x10002cau,0x8000002bu,0x6e6d02ccu,0x6a6902cdu,0x757402ceu,0x6a6902cfu,0x777602d0u,0x666502d1u,0x2f2e02d2u,0x736102d3u,0x757402e5u,0x0u,0x706f02f5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f6402fau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261030au,0x757402e6u,0x737202e7u,0x6a6902e8u,0x636202e9u,0x767502eau,0x757402ebu,0x666502ecu,0x343002edu,0x10002f1u,0x10002f2u,0x10002f3u,0x10002f4u,0x8000002cu,0x8000002du,0x8000002eu,0x8000002fu,0x6d6c02f6u,0x706f02f7u,0x737202f8u,0x10002f9u,0x80000030u,0x1000305u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640306u,0x80000031u,0x66650307u,0x79780308u,0x1000309u,0x80000032u,0x6564030bu,0x6a69030cu,0x7675030du,0x7473030eu,0x100030fu,0x80000033u,0x65640315u,0x0u,0x0u,0x0u,0x6f6e031au,0x6a690316u,0x76750317u,0x74730318u,0x1000319u,0x80000034u,0x6564031bu,0x6665031cu,0x7372031du,0x6665031eu,0x7372031fu,0x1000320u,0x80000035u,0x7b7a032eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610331u,0x0u,0x0u,0x0u,0x66610337u,0x737203adu,0x6665032fu,0x1000330u,0x80000036u,0x64630332u,0x6a690333u,0x6f6e0334u,0x68670335u,0x1000336u,0x80000037u,0x7574033cu,0x0u,0x0u,0x0u,0x737203a5u,0x7675033du,0x7473033eu,0x4443033fu,0x62610340u,0x6d6c0341u,0x6d6c0342u,0x63620343u,0x62610344u,0x64630345u,0x6c6b0346u,0x56000347u,0x80000038u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473039du,0x6665039eu,0x7372039fu,0x454403a0u,0x626103a1u,0x757403a2u,0x626103a3u,0x10003a4u,0x80000039u,0x666503a6u,0x706f03a7u,0x4e4d03a8u,0x706f03a9u,0x656403aau,0x666503abu,0x10003acu,0x8000003au,0x676603aeu,0x626103afu,0x646303b0u,0x666503b1u,0x10003b2u,0x8000003bu,0x626103b4u,0x6f6e03b5u,0x747303b6u,0x676603b7u,0x706f03b8u,0x737203b9u,0x6e6d03bau,0x10003bbu,0x8000003cu,0x10003bdu,0x8000003du,0x6d6c03cdu,0x0u,0x0u,0x0u,0x737203d6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c042fu,0x767503ceu,0x666503cfu,0x535203d0u,0x626103d1u,0x6f6e03d2u,0x686703d3u,0x666503d4u,0x10003d5u,0x8000003eu,0x757403d7u,0x666503d8u,0x797803d9u,0x2f2e03dau,0x756103dbu,0x757403efu,0x0u,0x706103ffu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0414u,0x0u,0x706f041au,0x0u,0x62610422u,0x0u,0x62610428u,0x757403f0u,0x737203f1u,0x6a6903f2u,0x636203f3u,0x767503f4u,0x757403f5u,0x666503f6u,0x343003f7u,0x10003fbu,0x10003fcu,0x10003fdu,0x10003feu,0x8000003fu,0x80000040u,0x80000041u,0x80000042u,0x7170040eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0410u,0x100040fu,0x80000043u,0x706f0411u,0x73720412u,0x1000413u,0x80000044u,0x73720415u,0x6e6d0416u,0x62610417u,0x6d6c0418u,0x1000419u,0x80000045u,0x7473041bu,0x6a69041cu,0x7574041du,0x6a69041eu,0x706f041fu,0x6f6e0420u,0x1000421u,0x80000046u,0x65640423u,0x6a690424u,0x76750425u,0x74730426u,0x1000427u,0x80000047u,0x6f6e0429u,0x6867042au,0x6665042bu,0x6f6e042cu,0x7574042du,0x100042eu,0x80000048u,0x76750430u,0x6e6d0431u,0x66650432u,0x1000433u,0x80000049u,0x73720438u,0x0u,0x0u,0x6261043cu,0x6d6c0439u,0x6564043au,0x100043bu,0x8000004au,0x7170043du,0x4e4d043eu,0x706f043fu,0x65640440u,0x66650441u,0x34310442u,0x1000445u,0x1000446u,0x1000447u,0x8000004bu,0x8000004cu,0x8000004du};
+   static const uint32_t table[] = {0x746c0017u,0x62610091u,0x7061009bu,0x6a610148u,0x0u,0x7061019du,0x73650243u,0x6665025cu,0x6f640262u,0x0u,0x0u,0x6a690344u,0x70610349u,0x66610362u,0x7670036du,0x736903cbu,0x0u,0x66610475u,0x76690502u,0x736105bfu,0x717005e7u,0x706105e9u,0x736f065fu,0x716c001fu,0x6362004eu,0x0u,0x5444005cu,0x6665007bu,0x0u,0x73720088u,0x7170008cu,0x706f0024u,0x0u,0x0u,0x0u,0x69680037u,0x78770025u,0x4a490026u,0x6f6e0027u,0x77760028u,0x62610029u,0x6d6c002au,0x6a69002bu,0x6564002cu,0x4e4d002du,0x6261002eu,0x7574002fu,0x66650030u,0x73720031u,0x6a690032u,0x62610033u,0x6d6c0034u,0x74730035u,0x1000036u,0x80000000u,0x62610038u,0x4e430039u,0x76750044u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004au,0x75740045u,0x706f0046u,0x67660047u,0x67660048u,0x1000049u,0x80000001u,0x6564004bu,0x6665004cu,0x100004du,0x80000002u,0x6a69004fu,0x66650050u,0x6f6e0051u,0x75740052u,0x53520053u,0x62610054u,0x65640055u,0x6a690056u,0x62610057u,0x6f6e0058u,0x64630059u,0x6665005au,0x100005bu,0x80000003u,0x6a69006cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610074u,0x7473006du,0x7574006eu,0x6261006fu,0x6f6e0070u,0x64630071u,0x66650072u,0x1000073u,0x80000004u,0x6e6d0075u,0x71700076u,0x6d6c0077u,0x66650078u,0x74730079u,0x100007au,0x80000005u,0x7372007cu,0x7574007du,0x7675007eu,0x7372007fu,0x66650080u,0x53520081u,0x62610082u,0x65640083u,0x6a690084u,0x76750085u,0x74730086u,0x1000087u,0x80000006u,0x62610089u,0x7a79008au,0x100008bu,0x80000007u,0x6665008du,0x6463008eu,0x7574008fu,0x1000090u,0x80000008u,0x64630092u,0x6c6b0093u,0x68670094u,0x73720095u,0x706f0096u,0x76750097u,0x6f6e0098u,0x65640099u,0x100009au,0x80000009u,0x716d00aau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100b4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c010du,0x666500aeu,0x0u,0x0u,0x747300b2u,0x737200afu,0x626100b0u,0x10000b1u,0x8000000au,0x10000b3u,0x8000000bu,0x6f6e00b5u,0x6f6e00b6u,0x666500b7u,0x6d6c00b8u,0x2f2e00b9u,0x776100bau,0x6d6c00d0u,0x0u,0x706f00d6u,0x666500dbu,0x0u,0x0u,0x0u,0x0u,0x6f6e00e0u,0x0u,0x0u,0x0u,0x0u,0x706f00eau,0x636200f0u,0x737200f8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690103u,0x636200d1u,0x666500d2u,0x656400d3u,0x706f00d4u,0x10000d5u,0x8000000cu,0x6d6c00d7u,0x706f00d8u,0x737200d9u,0x10000dau,0x8000000du,0x717000dcu,0x757400ddu,0x696800deu,0x10000dfu,0x8000000eu,0x747300e1u,0x757400e2u,0x626100e3u,0x6f6e00e4u,0x646300e5u,0x666500e6u,0x4a4900e7u,0x656400e8u,0x10000e9u,0x8000000fu,0x737200ebu,0x6e6d00ecu,0x626100edu,0x6d6c00eeu,0x10000efu,0x80000010u,0x6b6a00f1u,0x666500f2u,0x646300f3u,0x757400f4u,0x4a4900f5u,0x656400f6u,0x10000f7u,0x80000011u,0x6a6900f9u,0x6e6d00fau,0x6a6900fbu,0x757400fcu,0x6a6900fdu,0x777600feu,0x666500ffu,0x4a490100u,0x65640101u,0x1000102u,0x80000012u,0x74730104u,0x6a690105u,0x63620106u,0x6a690107u,0x6d6c0108u,0x6a690109u,0x7574010au,0x7a79010bu,0x100010cu,0x80000013u,0x706f010eu,0x7372010fu,0x2f000110u,0x80000014u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7170013fu,0x706f0140u,0x74730141u,0x6a690142u,0x75740143u,0x6a690144u,0x706f0145u,0x6f6e0146u,0x1000147u,0x80000015u,0x75740151u,0x0u,0x0u,0x0u,0x6f640154u,0x0u,0x0u,0x0u,0x7372017eu,0x62610152u,0x1000153u,0x80000016u,0x7675015fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x746f016cu,0x71700160u,0x6d6c0161u,0x6a690162u,0x64630163u,0x62610164u,0x75740165u,0x66650166u,0x45440167u,0x62610168u,0x75740169u,0x6261016au,0x100016bu,0x80000017u,0x6a690171u,0x0u,0x0u,0x0u,0x6a690175u,0x74730172u,0x66650173u,0x1000174u,0x80000018u,0x75740176u,0x7a790177u,0x54530178u,0x64630179u,0x6261017au,0x6d6c017bu,0x6665017cu,0x100017du,0x80000019u,0x7565017fu,0x6463018fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a790195u,0x75740190u,0x6a690191u,0x706f0192u,0x6f6e0193u,0x1000194u,0x8000001au,0x53520196u,0x66650197u,0x68670198u,0x6a690199u,0x706f019au,0x6f6e019bu,0x100019cu,0x8000001bu,0x737201acu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6501aeu,0x0u,0x0u,0x0u,0x0u,0x0u,0x77630222u,0x10001adu,0x8000001cu,0x6d6c01b6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x756501b9u,0x656401b7u,0x10001b8u,0x8000001du,0x500001c9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665021fu,0x8000001eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660219u,0x6766021au,0x7473021bu,0x6665021cu,0x7574021du,0x100021eu,0x8000001fu,0x73720220u,0x1000221u,0x80000020u,0x76750236u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a790241u,0x74730237u,0x45440238u,0x6a690239u,0x7473023au,0x7574023bu,0x6261023cu,0x6f6e023du,0x6463023eu,0x6665023fu,0x1000240u,0x80000021u,0x1000242u,0x80000022u,0x706f0251u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0258u,0x6e6d0252u,0x66650253u,0x75740254u,0x73720255u,0x7a790256u,0x1000257u,0x80000023u,0x76750259u,0x7170025au,0x100025bu,0x80000024u,0x6a69025du,0x6867025eu,0x6968025fu,0x75740260u,0x1000261u,0x80000025u,0x100026du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261026eu,0x774102cau,0x80000026u,0x6867026fu,0x66650270u,0x53000271u,0x80000027u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666502c4u,0x686702c5u,0x6a6902c6u,0x706f02c7u,0x6f6e02c8u,0x10002c9u,0x80000028u,0x75740300u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660309u,0x0u,0x0u,0x0u,0x0u,0x7372030fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740318u,0x6665031eu,0x0u,0x62610332u,0x75740301u,0x73720302u,0x6a690303u,0x63620304u,0x76750305u,0x75740306u,0x66650307u,0x1000308u,0x80000029u,0x6766030au,0x7473030bu,0x6665030cu,0x7574030du,0x100030eu,0x8000002au,0x62610310u,0x6f6e0311u,0x74730312u,0x67660313u,0x706f0314u,0x73720315u,0x6e6d0316u,0x1000317u,0x8000002bu,0x62610319u,0x6f6e031au,0x6463031bu,0x6665031cu,0x100031du,0x8000002cu,0x7372031fu,0x71700320u,0x76750321u,0x71700322u,0x6a690323u,0x6d6c0324u,0x6d6c0325u,0x62610326u,0x73720327u,0x7a790328u,0x45440329u,0x6a69032au,0x7473032bu,0x7574032cu,0x6261032du,0x6f6e032eu,0x6463032fu,0x66650330u,0x1000331u,0x8000002du,0x6d6c0333u,0x6a690334u,0x65640335u,0x4e4d0336u,0x62610337u,0x75740338u,0x66650339u,0x7372033au,0x6a69033bu,0x6261033cu,0x6d6c033du,0x4443033eu,0x706f033fu,0x6d6c0340u,0x706f0341u,0x73720342u,0x1000343u,0x8000002eu,0x68670345u,0x69680346u,0x75740347u,0x1000348u,0x8000002fu,0x75740358u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564035fu,0x66650359u,0x7372035au,0x6a69035bu,0x6261035cu,0x6d6c035du,0x100035eu,0x80000030u,0x66650360u,0x1000361u,0x80000031u,0x6e6d0367u,0x0u,0x0u,0x0u,0x6261036au,0x66650368u,0x1000369u,0x80000032u,0x7372036bu,0x100036cu,0x80000033u,0x62610373u,0x0u,0x6a6903b0u,0x0u,0x0u,0x757403b5u,0x64630374u,0x6a690375u,0x75740376u,0x7a790377u,0x2f000378u,0x80000034u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x717003a7u,0x706f03a8u,0x747303a9u,0x6a6903aau,0x757403abu,0x6a6903acu,0x706f03adu,0x6f6e03aeu,0x10003afu,0x80000035u,0x686703b1u,0x6a6903b2u,0x6f6e03b3u,0x10003b4u,0x80000036u,0x554f03b6u,0x676603bcu,0x0u,0x0u,0x0u,0x0u,0x737203c2u,0x676603bdu,0x747303beu,0x666503bfu,0x757403c0u,0x10003c1u,0x80000037u,0x626103c3u,0x6f6e03c4u,0x747303c5u,0x676603c6u,0x706f03c7u,0x737203c8u,0x6e6d03c9u,0x10003cau,0x80000038u,0x646303d5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747303e1u,0x0u,0x0u,0x706903e8u,0x6c6b03d6u,0x2f2e03d7u,0x717003d8u,0x706f03d9u,0x747303dau,0x6a6903dbu,0x757403dcu,0x6a6903ddu,0x706f03deu,0x6f6e03dfu,0x10003e0u,0x80000039u,0x6a6903e2u,0x757403e3u,0x6a6903e4u,0x706f03e5u,0x6f6e03e6u,0x10003e7u,0x8000003au,0x6e6d03efu,0x0u,0x0u,0x0u,0x0u,0x0u,0x68670433u,0x6a6903f0u,0x757403f1u,0x6a6903f2u,0x777603f3u,0x666503f4u,0x2f2e03f5u,0x736103f6u,0x75740408u,0x0u,0x706f0418u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f64041du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261042du,0x75740409u,0x7372040au,0x6a69040bu,0x6362040cu,0x7675040du,0x7574040eu,0x6665040fu,0x34300410u,0x1000414u,0x1000415u,0x1000416u,0x1000417u,0x8000003bu,0x8000003cu,0x8000003du,0x8000003eu,0x6d6c0419u,0x706f041au,0x7372041bu,0x100041cu,0x8000003fu,0x1000428u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640429u,0x80000040u,0x6665042au,0x7978042bu,0x100042cu,0x80000041u,0x6564042eu,0x6a69042fu,0x76750430u,0x74730431u,0x1000432u,0x80000042u,0x73720434u,0x66650435u,0x74730436u,0x74730437u,0x6a690438u,0x77760439u,0x6665043au,0x2f00043bu,0x80000043u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7574046au,0x6a69046bu,0x6e6d046cu,0x6665046du,0x4342046eu,0x7675046fu,0x65640470u,0x68670471u,0x66650472u,0x75740473u,0x1000474u,0x80000044u,0x6564047au,0x0u,0x0u,0x0u,0x6f61047fu,0x6a69047bu,0x7675047cu,0x7473047du,0x100047eu,0x80000045u,0x6564048du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650493u,0x0u,0x656404fcu,0x504f048eu,0x6f6e048fu,0x6d6c0490u,0x7a790491u,0x1000492u,0x80000046u,0x62610494u,0x74730495u,0x66650496u,0x45440497u,0x66650498u,0x6d6c0499u,0x6665049au,0x7574049bu,0x6665049cu,0x7372049du,0x5600049eu,0x80000047u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747304f4u,0x666504f5u,0x737204f6u,0x454404f7u,0x626104f8u,0x757404f9u,0x626104fau,0x10004fbu,0x80000048u,0x666504fdu,0x737204feu,0x666504ffu,0x73720500u,0x1000501u,0x80000049u,0x7b7a050fu,0x0u,0x6a690512u,0x0u,0x0u,0x0u,0x0u,0x62610528u,0x0u,0x0u,0x0u,0x6661052eu,0x737205b9u,0x66650510u,0x1000511u,0x8000004au,0x71700513u,0x56550514u,0x6f6e0515u,0x64630516u,0x69680517u,0x62610518u,0x6f6e0519u,0x6867051au,0x6665051bu,0x6564051cu,0x5150051du,0x6261051eu,0x7372051fu,0x62610520u,0x6e6d0521u,0x66650522u,0x75740523u,0x66650524u,0x73720525u,0x74730526u,0x1000527u,0x8000004bu,0x64630529u,0x6a69052au,0x6f6e052bu,0x6867052cu,0x100052du,0x8000004cu,0x75740533u,0x0u,0x0u,0x0u,0x737205b1u,0x76750534u,0x74730535u,0x4e430536u,0x62610541u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6905a6u,0x6d6c0542u,0x6d6c0543u,0x63620544u,0x62610545u,0x64630546u,0x6c6b0547u,0x56000548u,0x8000004du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473059eu,0x6665059fu,0x737205a0u,0x454405a1u,0x626105a2u,0x757405a3u,0x626105a4u,0x10005a5u,0x8000004eu,0x6f6e05a7u,0x545305a8u,0x666505a9u,0x777605aau,0x666505abu,0x737205acu,0x6a6905adu,0x757405aeu,0x7a7905afu,0x10005b0u,0x8000004fu,0x666505b2u,0x706f05b3u,0x4e4d05b4u,0x706f05b5u,0x656405b6u,0x666505b7u,0x10005b8u,0x80000050u,0x676605bau,0x626105bbu,0x646305bcu,0x666505bdu,0x10005beu,0x80000051u,0x737205d1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626105dfu,0x686705d2u,0x666505d3u,0x757405d4u,0x474605d5u,0x737205d6u,0x626105d7u,0x6e6d05d8u,0x666505d9u,0x555405dau,0x6a6905dbu,0x6e6d05dcu,0x666505ddu,0x10005deu,0x80000052u,0x6f6e05e0u,0x747305e1u,0x676605e2u,0x706f05e3u,0x737205e4u,0x6e6d05e5u,0x10005e6u,0x80000053u,0x10005e8u,0x80000054u,0x6d6c05f8u,0x0u,0x0u,0x0u,0x73720601u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c065au,0x767505f9u,0x666505fau,0x535205fbu,0x626105fcu,0x6f6e05fdu,0x686705feu,0x666505ffu,0x1000600u,0x80000055u,0x75740602u,0x66650603u,0x79780604u,0x2f2e0605u,0x75610606u,0x7574061au,0x0u,0x7061062au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f063fu,0x0u,0x706f0645u,0x0u,0x6261064du,0x0u,0x62610653u,0x7574061bu,0x7372061cu,0x6a69061du,0x6362061eu,0x7675061fu,0x75740620u,0x66650621u,0x34300622u,0x1000626u,0x1000627u,0x1000628u,0x1000629u,0x80000056u,0x80000057u,0x80000058u,0x80000059u,0x71700639u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c063bu,0x100063au,0x8000005au,0x706f063cu,0x7372063du,0x100063eu,0x8000005bu,0x73720640u,0x6e6d0641u,0x62610642u,0x6d6c0643u,0x1000644u,0x8000005cu,0x74730646u,0x6a690647u,0x75740648u,0x6a690649u,0x706f064au,0x6f6e064bu,0x100064cu,0x8000005du,0x6564064eu,0x6a69064fu,0x76750650u,0x74730651u,0x1000652u,0x8000005eu,0x6f6e0654u,0x68670655u,0x66650656u,0x6f6e0657u,0x75740658u,0x1000659u,0x8000005fu,0x7675065bu,0x6e6d065cu,0x6665065du,0x100065eu,0x80000060u,0x73720663u,0x0u,0x0u,0x62610667u,0x6d6c0664u,0x65640665u,0x1000666u,0x80000061u,0x71700668u,0x4e4d0669u,0x706f066au,0x6564066bu,0x6665066cu,0x3431066du,0x1000670u,0x1000671u,0x1000672u,0x80000062u,0x80000063u,0x80000064u};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -78,6 +78,7 @@ static const int32_t anari_true = 1;
 static const int32_t anari_false = 0;
 const char ** query_extensions() {
    static const char *features[] = {
+      "ANARI_KHR_AUXILIARY_BUFFERS",
       "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
       "ANARI_KHR_CAMERA_PERSPECTIVE",
       "ANARI_KHR_GEOMETRY_CONE",
@@ -102,7 +103,7 @@ const char ** query_object_types(ANARIDataType type) {
    switch(type) {
       case ANARI_RENDERER:
       {
-         static const char *ANARI_RENDERER_subtypes[] = {"default", 0};
+         static const char *ANARI_RENDERER_subtypes[] = {"default", "ao", 0};
          return ANARI_RENDERER_subtypes;
       }
       case ANARI_CAMERA:
@@ -190,6 +191,78 @@ static const void * ANARI_DEVICE_invalidMaterialColor_info(ANARIDataType paramTy
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_deduplicateData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "share storage of identical arrays and BLSs of identical geometry";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_skipUnchangedParameters_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "setting a parameter to its current value does not mark the object updated";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_statusMinSeverity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(6)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "least severe ANARIStatusSeverity passed to the status callback, less severe messages are dropped before being formatted";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -245,13 +318,19 @@ static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType
    switch(param_hash(paramName)) {
       case 0:
          return ANARI_DEVICE_allowInvalidMaterials_info(paramType, infoName, infoType);
-      case 32:
+      case 46:
          return ANARI_DEVICE_invalidMaterialColor_info(paramType, infoName, infoType);
-      case 36:
+      case 23:
+         return ANARI_DEVICE_deduplicateData_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_DEVICE_skipUnchangedParameters_info(paramType, infoName, infoType);
+      case 79:
+         return ANARI_DEVICE_statusMinSeverity_info(paramType, infoName, infoType);
+      case 50:
          return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 56:
+      case 77:
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 57:
+      case 78:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -355,19 +434,19 @@ static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, in
 }
 static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 7:
+      case 9:
          return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
       case 3:
          return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
-      case 35:
+      case 49:
          return ANARI_RENDERER_default_mode_info(paramType, infoName, infoType);
-      case 36:
+      case 50:
          return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_background_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -376,23 +455,22 @@ static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "background color and alpha (RGBA)";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_ambientRadiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -401,23 +479,22 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "ambient light intensity";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_aoSamples_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -426,23 +503,22 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "ambient occlusion rays per pixel and frame, frames are accumulated";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_aoDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -451,83 +527,91 @@ static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "optional object name";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {100000000000000000000.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "world to be rendererd";
+            static const char *description = "maximum distance of occluders";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 9:
+         return ANARI_RENDERER_ao_background_info(paramType, infoName, infoType);
+      case 3:
+         return ANARI_RENDERER_ao_ambientRadiance_info(paramType, infoName, infoType);
+      case 5:
+         return ANARI_RENDERER_ao_aoSamples_info(paramType, infoName, infoType);
+      case 4:
+         return ANARI_RENDERER_ao_aoDistance_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "renderer which renders the frame";
+            static const char *description = "enables mapping the primitiveId channel (index of the hit primitive)";
             return description;
          }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "camera used to render the world";
-            return description;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the frame in pixels (width, height)";
+            static const char *description = "enables mapping the objectId channel (surface 'id' or index in its group)";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -538,12 +622,12 @@ static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the color channel as the type specified";
+            static const char *description = "enables mapping the instanceId channel (instance 'id' or index in the world)";
             return description;
          }
       case 6: // value
          if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -551,7 +635,7 @@ static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_visibility_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -562,12 +646,12 @@ static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the color channel as the type specified";
+            static const char *description = "enables mapping the visibility channel (255 where the ray hits anything, 0 otherwise)";
             return description;
          }
       case 6: // value
          if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -575,27 +659,7 @@ static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 74:
-         return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 11:
-         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_denoise_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -604,15 +668,22 @@ static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "filter the color channel with an edge-aware denoiser guided by normal, albedo and depth";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_targetFrameTime_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -621,22 +692,29 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "array of surface objects";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
-            return values;
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "frame time in seconds to reach by lowering the resolution while the scene changes, 0 disables";
+            return description;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_progressive_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -645,14 +723,178 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of volume objects";
+            static const char *description = "trace rays coarse-to-fine on 8x8, 4x4, 2x2 and 1x1 pixel blocks, map returns the best image available";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_progressive_timeBudget_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "seconds after which progressive refinement stops, 0 means unlimited";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_pick_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC2 && infoType == ANARI_FLOAT32_VEC2) {
+            static const float default_value[2] = {0.500000f, 0.500000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "screen position in [0, 1] of the ray cast by the 'pick.*' properties, read without commit";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "world to be rendererd";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "renderer which renders the frame";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera used to render the world";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "size of the frame in pixels (width, height)";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enables mapping the color channel as the type specified";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -660,7 +902,7 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -671,12 +913,12 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of light objects";
+            static const char *description = "enables mapping the color channel as the type specified";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -684,21 +926,113 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enables mapping the normal channel as the type specified";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceFeature
+         if(infoType == ANARI_STRING) {
+            static const char *feature = "KHR_AUXILIARY_BUFFERS";
+            return feature;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 0;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_channel_albedo_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enables mapping the albedo channel as the type specified";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC3, ANARI_UFIXED8_RGB_SRGB, ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceFeature
+         if(infoType == ANARI_STRING) {
+            static const char *feature = "KHR_AUXILIARY_BUFFERS";
+            return feature;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 0;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 59:
-         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
+      case 19:
+         return ANARI_FRAME_channel_visibility_info(paramType, infoName, infoType);
+      case 24:
+         return ANARI_FRAME_denoise_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_FRAME_targetFrameTime_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_FRAME_progressive_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_FRAME_progressive_timeBudget_info(paramType, infoName, infoType);
+      case 57:
+         return ANARI_FRAME_pick_position_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_FRAME_name_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_FRAME_world_info(paramType, infoName, infoType);
       case 73:
-         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_GROUP_light_info(paramType, infoName, infoType);
+         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
+      case 74:
+         return ANARI_FRAME_size_info(paramType, infoName, infoType);
+      case 13:
+         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_FRAME_channel_normal_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_FRAME_channel_albedo_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -709,13 +1043,667 @@ static const void * ANARI_INSTANCE_name_info(ANARIDataType paramType, int infoNa
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "user id written to the objectId frame channel";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "geometry object defining the surface geometry";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "material object defining the surface appearance";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 38:
+         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
+      case 35:
+         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user id written to the instanceId frame channel";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to objects in the instance";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "group object being instanced";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 38:
+         return ANARI_INSTANCE_id_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_INSTANCE_name_info(paramType, infoName, infoType);
+      case 83:
+         return ANARI_INSTANCE_transform_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_INSTANCE_group_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_readOnly_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "shared memory stays valid and unchanged while the device uses it, so releasing the array does not copy it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_releaseDeleter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "deleter taking over shared memory when the array is released while still in use, instead of copying it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_releaseDeleterUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user data passed to releaseDeleter";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_file_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "file to map the array data from when committed, replacing the current contents";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_fileOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "byte offset of the array data in 'file'";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_dirtyRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "range of elements [begin, end) written since the array was mapped, read by and cleared on the next unmap so only that part is updated";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 70:
+         return ANARI_ARRAY1D_readOnly_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_ARRAY1D_releaseDeleter_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_ARRAY1D_releaseDeleterUserData_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_ARRAY1D_file_info(paramType, infoName, infoType);
+      case 31:
+         return ANARI_ARRAY1D_fileOffset_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_ARRAY1D_dirtyRegion_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_readOnly_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "shared memory stays valid and unchanged while the device uses it, so releasing the array does not copy it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_releaseDeleter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "deleter taking over shared memory when the array is released while still in use, instead of copying it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_releaseDeleterUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user data passed to releaseDeleter";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_file_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "file to map the array data from when committed, replacing the current contents";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_fileOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "byte offset of the array data in 'file'";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_dirtyRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "range of elements [begin, end) written since the array was mapped, read by and cleared on the next unmap so only that part is updated";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 70:
+         return ANARI_ARRAY2D_readOnly_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_ARRAY2D_releaseDeleter_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_ARRAY2D_releaseDeleterUserData_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_ARRAY2D_file_info(paramType, infoName, infoType);
+      case 31:
+         return ANARI_ARRAY2D_fileOffset_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_ARRAY2D_dirtyRegion_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_readOnly_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "shared memory stays valid and unchanged while the device uses it, so releasing the array does not copy it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_releaseDeleter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "deleter taking over shared memory when the array is released while still in use, instead of copying it";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_releaseDeleterUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user data passed to releaseDeleter";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_file_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "file to map the array data from when committed, replacing the current contents";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_fileOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "byte offset of the array data in 'file'";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_dirtyRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "range of elements [begin, end) written since the array was mapped, read by and cleared on the next unmap so only that part is updated";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 70:
+         return ANARI_ARRAY3D_readOnly_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_ARRAY3D_releaseDeleter_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_ARRAY3D_releaseDeleterUserData_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_ARRAY3D_file_info(paramType, infoName, infoType);
+      case 31:
+         return ANARI_ARRAY3D_fileOffset_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_ARRAY3D_dirtyRegion_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of surface objects";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -724,46 +1712,55 @@ static const void * ANARI_INSTANCE_transform_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to objects in the instance";
+            static const char *description = "array of volume objects";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "group object being instanced";
+            static const char *description = "array of light objects";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_INSTANCE_name_info(paramType, infoName, infoType);
-      case 60:
-         return ANARI_INSTANCE_transform_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_INSTANCE_group_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_GROUP_name_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
+      case 47:
+         return ANARI_GROUP_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -883,83 +1880,20 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
 }
 static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 30:
+      case 44:
          return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 59:
+      case 81:
          return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 73:
+      case 96:
          return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 33:
+      case 47:
          return ANARI_WORLD_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "optional object name";
-            return description;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "geometry object defining the surface geometry";
-            return description;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "material object defining the surface appearance";
-            return description;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 36:
-         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
 static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -979,7 +1913,7 @@ static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1017,7 +1951,7 @@ static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramT
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1055,7 +1989,7 @@ static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType param
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1093,7 +2027,7 @@ static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, i
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1125,7 +2059,7 @@ static const void * ANARI_CAMERA_orthographic_transform_info(ANARIDataType param
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1157,7 +2091,7 @@ static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType par
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1189,7 +2123,7 @@ static const void * ANARI_CAMERA_orthographic_apertureRadius_info(ANARIDataType
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1221,7 +2155,7 @@ static const void * ANARI_CAMERA_orthographic_focusDistance_info(ANARIDataType p
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1260,7 +2194,7 @@ static const void * ANARI_CAMERA_orthographic_stereoMode_info(ANARIDataType para
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1292,7 +2226,7 @@ static const void * ANARI_CAMERA_orthographic_interpupillaryDistance_info(ANARID
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1324,7 +2258,7 @@ static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramTyp
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1356,7 +2290,7 @@ static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramTyp
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1381,7 +2315,7 @@ static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1406,7 +2340,7 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
@@ -1414,33 +2348,33 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
 }
 static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
-      case 43:
+      case 58:
          return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 16:
+      case 26:
          return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 61:
+      case 84:
          return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 60:
+      case 83:
          return ANARI_CAMERA_orthographic_transform_info(paramType, infoName, infoType);
-      case 26:
+      case 40:
          return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 4:
+      case 6:
          return ANARI_CAMERA_orthographic_apertureRadius_info(paramType, infoName, infoType);
-      case 20:
+      case 33:
          return ANARI_CAMERA_orthographic_focusDistance_info(paramType, infoName, infoType);
-      case 58:
+      case 80:
          return ANARI_CAMERA_orthographic_stereoMode_info(paramType, infoName, infoType);
-      case 31:
+      case 45:
          return ANARI_CAMERA_orthographic_interpupillaryDistance_info(paramType, infoName, infoType);
-      case 24:
+      case 37:
          return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 6:
+      case 8:
          return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 37:
+      case 51:
          return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 17:
+      case 28:
          return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1465,7 +2399,7 @@ static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1503,7 +2437,7 @@ static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramTy
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1541,7 +2475,7 @@ static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramT
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1579,7 +2513,7 @@ static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, in
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1611,7 +2545,7 @@ static const void * ANARI_CAMERA_perspective_transform_info(ANARIDataType paramT
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1643,7 +2577,7 @@ static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType para
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1675,7 +2609,7 @@ static const void * ANARI_CAMERA_perspective_apertureRadius_info(ANARIDataType p
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1707,7 +2641,7 @@ static const void * ANARI_CAMERA_perspective_focusDistance_info(ANARIDataType pa
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1746,7 +2680,7 @@ static const void * ANARI_CAMERA_perspective_stereoMode_info(ANARIDataType param
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1778,7 +2712,7 @@ static const void * ANARI_CAMERA_perspective_interpupillaryDistance_info(ANARIDa
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1810,7 +2744,7 @@ static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1842,7 +2776,7 @@ static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1867,7 +2801,7 @@ static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType,
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1892,7 +2826,7 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 2;
             return &value;
          }
       default: return nullptr;
@@ -1900,33 +2834,33 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
 }
 static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
-      case 43:
+      case 58:
          return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 16:
+      case 26:
          return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 61:
+      case 84:
          return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 60:
+      case 83:
          return ANARI_CAMERA_perspective_transform_info(paramType, infoName, infoType);
-      case 26:
+      case 40:
          return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 4:
+      case 6:
          return ANARI_CAMERA_perspective_apertureRadius_info(paramType, infoName, infoType);
-      case 20:
+      case 33:
          return ANARI_CAMERA_perspective_focusDistance_info(paramType, infoName, infoType);
-      case 58:
+      case 80:
          return ANARI_CAMERA_perspective_stereoMode_info(paramType, infoName, infoType);
-      case 31:
+      case 45:
          return ANARI_CAMERA_perspective_interpupillaryDistance_info(paramType, infoName, infoType);
-      case 21:
+      case 34:
          return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 6:
+      case 8:
          return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 37:
+      case 51:
          return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 17:
+      case 28:
          return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1951,7 +2885,7 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -1983,7 +2917,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2015,7 +2949,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2047,7 +2981,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2079,7 +3013,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2111,7 +3045,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2143,7 +3077,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramTyp
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2175,7 +3109,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2207,7 +3141,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2239,7 +3173,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2271,7 +3205,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2303,7 +3237,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2335,7 +3269,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2367,7 +3301,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2399,7 +3333,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2431,7 +3365,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2470,7 +3404,7 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2478,39 +3412,39 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
 }
 static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 71:
+      case 94:
          return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 67:
+      case 90:
          return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
-      case 9:
+      case 11:
          return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2535,7 +3469,7 @@ static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2567,7 +3501,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2599,7 +3533,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2631,7 +3565,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2663,7 +3597,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2695,7 +3629,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2727,7 +3661,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramTy
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2759,7 +3693,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2791,7 +3725,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramT
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2823,7 +3757,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2855,7 +3789,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2887,7 +3821,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2919,7 +3853,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2951,7 +3885,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2983,7 +3917,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -3008,7 +3942,7 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 3;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -3016,37 +3950,37 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
 }
 static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 71:
+      case 94:
          return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
-      case 52:
+      case 69:
          return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -3071,7 +4005,7 @@ static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, i
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3103,7 +4037,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3135,7 +4069,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3167,7 +4101,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3199,7 +4133,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3231,7 +4165,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3263,7 +4197,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3295,7 +4229,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3327,7 +4261,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramT
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3359,7 +4293,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3391,7 +4325,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3423,7 +4357,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3455,7 +4389,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3487,7 +4421,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3519,7 +4453,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3551,7 +4485,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3576,7 +4510,7 @@ static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType,
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3615,7 +4549,7 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
@@ -3623,41 +4557,41 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 67:
+      case 90:
          return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
-      case 51:
+      case 66:
          return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
-      case 52:
+      case 69:
          return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
-      case 9:
+      case 11:
          return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -3682,7 +4616,7 @@ static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int i
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3714,7 +4648,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3746,7 +4680,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3778,7 +4712,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3810,7 +4744,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3842,7 +4776,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3874,7 +4808,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramTyp
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3906,7 +4840,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3938,7 +4872,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramTy
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -3970,7 +4904,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramT
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4002,7 +4936,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramTyp
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4034,7 +4968,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4066,7 +5000,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4098,7 +5032,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4130,7 +5064,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4162,7 +5096,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
@@ -4170,37 +5104,37 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
 }
 static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 69:
+      case 92:
          return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 72:
+      case 95:
          return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4225,7 +5159,7 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4257,7 +5191,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4289,7 +5223,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4321,7 +5255,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4353,7 +5287,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4385,7 +5319,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4417,7 +5351,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4449,7 +5383,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4481,7 +5415,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4513,7 +5447,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4545,7 +5479,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4577,7 +5511,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4609,7 +5543,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4641,7 +5575,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4673,7 +5607,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4698,7 +5632,7 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -4706,37 +5640,37 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 71:
+      case 94:
          return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 52:
+      case 69:
          return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4761,7 +5695,7 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4793,7 +5727,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4825,7 +5759,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4857,7 +5791,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4889,7 +5823,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4921,7 +5855,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4953,7 +5887,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -4985,7 +5919,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5017,7 +5951,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5049,7 +5983,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5081,7 +6015,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5113,7 +6047,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5145,7 +6079,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5177,7 +6111,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5209,7 +6143,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5241,7 +6175,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -5249,37 +6183,37 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
 }
 static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 48:
+      case 63:
          return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 44:
+      case 59:
          return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 45:
+      case 60:
          return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 46:
+      case 61:
          return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 47:
+      case 62:
          return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 49:
+      case 64:
          return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 70:
+      case 93:
          return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 69:
+      case 92:
          return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 72:
+      case 95:
          return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 68:
+      case 91:
          return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 63:
+      case 86:
          return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 64:
+      case 87:
          return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 65:
+      case 88:
          return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 66:
+      case 89:
          return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 50:
+      case 65:
          return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5304,7 +6238,7 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -5349,7 +6283,7 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -5388,7 +6322,7 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -5427,7 +6361,7 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -5459,7 +6393,7 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -5467,11 +6401,11 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
 }
 static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
-      case 12:
+      case 20:
          return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 38:
+      case 52:
          return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
       case 2:
          return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
@@ -5500,7 +6434,7 @@ static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5532,7 +6466,7 @@ static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, in
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5571,7 +6505,7 @@ static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5610,7 +6544,7 @@ static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, i
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5649,7 +6583,7 @@ static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5681,7 +6615,7 @@ static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5713,7 +6647,7 @@ static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType,
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5745,7 +6679,7 @@ static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramT
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5777,7 +6711,7 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -5785,23 +6719,23 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
-      case 25:
+      case 39:
          return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
-      case 27:
+      case 41:
          return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
-      case 19:
+      case 32:
          return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 75:
+      case 98:
          return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
-      case 29:
+      case 43:
          return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
       case 42:
+         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
+      case 56:
          return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
-      case 41:
+      case 55:
          return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5826,7 +6760,7 @@ static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -5858,7 +6792,7 @@ static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, in
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -5897,7 +6831,7 @@ static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -5936,7 +6870,7 @@ static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, i
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -5975,7 +6909,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6014,7 +6948,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6046,7 +6980,7 @@ static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6078,7 +7012,7 @@ static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType,
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6110,7 +7044,7 @@ static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramT
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6142,7 +7076,7 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -6150,25 +7084,25 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
-      case 25:
+      case 39:
          return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
-      case 27:
+      case 41:
          return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
-      case 19:
+      case 32:
          return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 75:
+      case 98:
          return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 76:
+      case 99:
          return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
-      case 29:
+      case 43:
          return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
       case 42:
+         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
+      case 56:
          return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
-      case 41:
+      case 55:
          return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6193,7 +7127,7 @@ static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6225,7 +7159,7 @@ static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, in
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6264,7 +7198,7 @@ static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6303,7 +7237,7 @@ static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, i
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6342,7 +7276,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6381,7 +7315,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6420,7 +7354,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6452,7 +7386,7 @@ static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6484,7 +7418,7 @@ static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType,
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6516,7 +7450,7 @@ static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramT
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6548,7 +7482,7 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -6556,27 +7490,27 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
-      case 25:
+      case 39:
          return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
-      case 27:
+      case 41:
          return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
-      case 19:
+      case 32:
          return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
-      case 75:
+      case 98:
          return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
-      case 76:
+      case 99:
          return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
-      case 77:
+      case 100:
          return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
-      case 29:
+      case 43:
          return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
       case 42:
+         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
+      case 56:
          return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
-      case 41:
+      case 55:
          return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6601,7 +7535,7 @@ static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, i
             static const char *feature = "KHR_SAMPLER_PRIMITIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -6633,7 +7567,7 @@ static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType,
             static const char *feature = "KHR_SAMPLER_PRIMITIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -6665,7 +7599,7 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
             static const char *feature = "KHR_SAMPLER_PRIMITIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -6673,11 +7607,11 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
 }
 static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
-      case 5:
+      case 7:
          return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
-      case 28:
+      case 42:
          return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6702,7 +7636,7 @@ static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, i
             static const char *feature = "KHR_SAMPLER_TRANSFORM";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -6741,7 +7675,7 @@ static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType param
             static const char *feature = "KHR_SAMPLER_TRANSFORM";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -6773,7 +7707,7 @@ static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType para
             static const char *feature = "KHR_SAMPLER_TRANSFORM";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -6805,7 +7739,7 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
             static const char *feature = "KHR_SAMPLER_TRANSFORM";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -6813,13 +7747,13 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
 }
 static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
-      case 27:
+      case 41:
          return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
-      case 42:
+      case 56:
          return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
-      case 41:
+      case 55:
          return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6844,7 +7778,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataTyp
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6876,7 +7810,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataTyp
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6908,7 +7842,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6940,7 +7874,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6979,7 +7913,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6987,15 +7921,15 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
 }
 static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
-      case 14:
+      case 22:
          return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
-      case 40:
+      case 54:
          return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
-      case 55:
+      case 76:
          return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
-      case 19:
+      case 32:
          return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7020,7 +7954,7 @@ static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType para
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7045,7 +7979,7 @@ static const void * ANARI_VOLUME_transferFunction1D_field_info(ANARIDataType par
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7077,7 +8011,7 @@ static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataTyp
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7109,7 +8043,7 @@ static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType par
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7141,7 +8075,7 @@ static const void * ANARI_VOLUME_transferFunction1D_color_position_info(ANARIDat
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7173,7 +8107,7 @@ static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType p
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7205,7 +8139,7 @@ static const void * ANARI_VOLUME_transferFunction1D_opacity_position_info(ANARID
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7237,7 +8171,7 @@ static const void * ANARI_VOLUME_transferFunction1D_densityScale_info(ANARIDataT
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -7245,21 +8179,21 @@ static const void * ANARI_VOLUME_transferFunction1D_densityScale_info(ANARIDataT
 }
 static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 36:
+      case 50:
          return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
-      case 18:
+      case 29:
          return ANARI_VOLUME_transferFunction1D_field_info(paramType, infoName, infoType);
-      case 62:
+      case 85:
          return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
-      case 12:
+      case 20:
          return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
-      case 13:
+      case 21:
          return ANARI_VOLUME_transferFunction1D_color_position_info(paramType, infoName, infoType);
-      case 38:
+      case 52:
          return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
-      case 39:
+      case 53:
          return ANARI_VOLUME_transferFunction1D_opacity_position_info(paramType, infoName, infoType);
-      case 15:
+      case 25:
          return ANARI_VOLUME_transferFunction1D_densityScale_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7267,9 +8201,9 @@ static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *param
 }
 static const void * ANARI_CAMERA_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 8:
-         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
       case 9:
+         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
+      case 10:
          return ANARI_CAMERA_perspective_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7277,17 +8211,17 @@ static const void * ANARI_CAMERA_param_info(const char *subtype, const char *par
 }
 static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 0:
-         return ANARI_GEOMETRY_cone_param_info(paramName, paramType, infoName, infoType);
       case 1:
-         return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_param_info(paramName, paramType, infoName, infoType);
       case 2:
+         return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
+      case 3:
          return ANARI_GEOMETRY_cylinder_param_info(paramName, paramType, infoName, infoType);
-      case 11:
-         return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
       case 12:
+         return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
+      case 13:
          return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
-      case 16:
+      case 17:
          return ANARI_GEOMETRY_triangle_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7295,7 +8229,7 @@ static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 7:
+      case 8:
          return ANARI_MATERIAL_matte_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7303,23 +8237,25 @@ static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_RENDERER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 3:
+      case 4:
          return ANARI_RENDERER_default_param_info(paramName, paramType, infoName, infoType);
+      case 0:
+         return ANARI_RENDERER_ao_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
 static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 4:
-         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 5:
-         return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
+         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 6:
+         return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
+      case 7:
          return ANARI_SAMPLER_image3D_param_info(paramName, paramType, infoName, infoType);
-      case 10:
+      case 11:
          return ANARI_SAMPLER_primitive_param_info(paramName, paramType, infoName, infoType);
-      case 15:
+      case 16:
          return ANARI_SAMPLER_transform_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7327,7 +8263,7 @@ static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *pa
 }
 static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 13:
+      case 14:
          return ANARI_SPATIAL_FIELD_structuredRegular_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7335,7 +8271,7 @@ static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const ch
 }
 static const void * ANARI_VOLUME_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 14:
+      case 15:
          return ANARI_VOLUME_transferFunction1D_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7359,22 +8295,22 @@ const void * query_param_info_enum(ANARIDataType type, const char *subtype, cons
          return ANARI_VOLUME_param_info(subtype, paramName, paramType, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_SURFACE:
+         return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_INSTANCE:
+         return ANARI_INSTANCE_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
       case ANARI_GROUP:
          return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_INSTANCE:
-         return ANARI_INSTANCE_param_info(paramName, paramType, infoName, infoType);
       case ANARI_WORLD:
          return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_SURFACE:
-         return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -7395,6 +8331,9 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
             static const ANARIParameter parameters[] = {
                {"allowInvalidMaterials", ANARI_BOOL},
                {"invalidMaterialColor", ANARI_FLOAT32_VEC4},
+               {"deduplicateData", ANARI_BOOL},
+               {"skipUnchangedParameters", ANARI_BOOL},
+               {"statusMinSeverity", ANARI_INT32},
                {"name", ANARI_STRING},
                {"statusCallback", ANARI_STATUS_CALLBACK},
                {"statusCallbackUserData", ANARI_VOID_POINTER},
@@ -7407,6 +8346,7 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
       case 8: // feature
          if(infoType == ANARI_STRING_LIST) {
             static const char *features[] = {
+               "ANARI_KHR_AUXILIARY_BUFFERS",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
                "ANARI_KHR_GEOMETRY_CONE",
@@ -7455,6 +8395,7 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
       case 8: // feature
          if(infoType == ANARI_STRING_LIST) {
             static const char *features[] = {
+               "ANARI_KHR_AUXILIARY_BUFFERS",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
                "ANARI_KHR_GEOMETRY_CONE",
@@ -7480,37 +8421,118 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_ao_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"background", ANARI_FLOAT32_VEC4},
+               {"ambientRadiance", ANARI_FLOAT32},
+               {"aoSamples", ANARI_UINT32},
+               {"aoDistance", ANARI_FLOAT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 8: // feature
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *features[] = {
+               "ANARI_KHR_AUXILIARY_BUFFERS",
+               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
+               "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_GEOMETRY_CONE",
+               "ANARI_KHR_GEOMETRY_CURVE",
+               "ANARI_KHR_GEOMETRY_CYLINDER",
+               "ANARI_KHR_GEOMETRY_QUAD",
+               "ANARI_KHR_GEOMETRY_SPHERE",
+               "ANARI_KHR_GEOMETRY_TRIANGLE",
+               "ANARI_KHR_MATERIAL_MATTE",
+               "ANARI_KHR_SAMPLER_IMAGE1D",
+               "ANARI_KHR_SAMPLER_IMAGE2D",
+               "ANARI_KHR_SAMPLER_IMAGE3D",
+               "ANARI_KHR_SAMPLER_PRIMITIVE",
+               "ANARI_KHR_SAMPLER_TRANSFORM",
+               "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
+               "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
+               0
+            };
+            return features;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "one dimensional array object";
+            static const char *description = "frame object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"channel.primitiveId", ANARI_DATA_TYPE},
+               {"channel.objectId", ANARI_DATA_TYPE},
+               {"channel.instanceId", ANARI_DATA_TYPE},
+               {"channel.visibility", ANARI_DATA_TYPE},
+               {"denoise", ANARI_BOOL},
+               {"targetFrameTime", ANARI_FLOAT32},
+               {"progressive", ANARI_BOOL},
+               {"progressive.timeBudget", ANARI_FLOAT32},
+               {"pick.position", ANARI_FLOAT32_VEC2},
                {"name", ANARI_STRING},
+               {"world", ANARI_WORLD},
+               {"renderer", ANARI_RENDERER},
+               {"camera", ANARI_CAMERA},
+               {"size", ANARI_UINT32_VEC2},
+               {"channel.color", ANARI_DATA_TYPE},
+               {"channel.depth", ANARI_DATA_TYPE},
+               {"channel.normal", ANARI_DATA_TYPE},
+               {"channel.albedo", ANARI_DATA_TYPE},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 10: // channel
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *channel[] = {
+               "channel.primitiveId",
+               "channel.objectId",
+               "channel.instanceId",
+               "channel.visibility",
+               "channel.color",
+               "channel.depth",
+               "channel.normal",
+               "channel.albedo",
+               0
+            };
+            return channel;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "two dimensional array object";
+            static const char *description = "surface object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"id", ANARI_UINT32},
                {"name", ANARI_STRING},
+               {"geometry", ANARI_GEOMETRY},
+               {"material", ANARI_MATERIAL},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -7520,17 +8542,20 @@ static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "three dimensional array object";
+            static const char *description = "instance object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"id", ANARI_UINT32},
                {"name", ANARI_STRING},
+               {"transform", ANARI_FLOAT32_MAT4},
+               {"group", ANARI_GROUP},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -7540,57 +8565,49 @@ static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "frame object";
+            static const char *description = "one dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"readOnly", ANARI_BOOL},
+               {"releaseDeleter", ANARI_MEMORY_DELETER},
+               {"releaseDeleterUserData", ANARI_VOID_POINTER},
+               {"file", ANARI_STRING},
+               {"fileOffset", ANARI_UINT64},
+               {"dirtyRegion", ANARI_UINT64_REGION1},
                {"name", ANARI_STRING},
-               {"world", ANARI_WORLD},
-               {"renderer", ANARI_RENDERER},
-               {"camera", ANARI_CAMERA},
-               {"size", ANARI_UINT32_VEC2},
-               {"channel.color", ANARI_DATA_TYPE},
-               {"channel.depth", ANARI_DATA_TYPE},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 10: // channel
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *channel[] = {
-               "channel.color",
-               "channel.depth",
-               0
-            };
-            return channel;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "group object";
+            static const char *description = "two dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"readOnly", ANARI_BOOL},
+               {"releaseDeleter", ANARI_MEMORY_DELETER},
+               {"releaseDeleterUserData", ANARI_VOID_POINTER},
+               {"file", ANARI_STRING},
+               {"fileOffset", ANARI_UINT64},
+               {"dirtyRegion", ANARI_UINT64_REGION1},
                {"name", ANARI_STRING},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -7600,19 +8617,23 @@ static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "instance object";
+            static const char *description = "three dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"readOnly", ANARI_BOOL},
+               {"releaseDeleter", ANARI_MEMORY_DELETER},
+               {"releaseDeleterUserData", ANARI_VOID_POINTER},
+               {"file", ANARI_STRING},
+               {"fileOffset", ANARI_UINT64},
+               {"dirtyRegion", ANARI_UINT64_REGION1},
                {"name", ANARI_STRING},
-               {"transform", ANARI_FLOAT32_MAT4},
-               {"group", ANARI_GROUP},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -7622,18 +8643,17 @@ static const void * ANARI_INSTANCE_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "world object";
+            static const char *description = "group object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"instance", ANARI_ARRAY1D},
                {"surface", ANARI_ARRAY1D},
                {"volume", ANARI_ARRAY1D},
                {"light", ANARI_ARRAY1D},
@@ -7646,19 +8666,21 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "surface object";
+            static const char *description = "world object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"geometry", ANARI_GEOMETRY},
-               {"material", ANARI_MATERIAL},
+               {"instance", ANARI_ARRAY1D},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -7703,7 +8725,7 @@ static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType i
             static const char *feature = "KHR_CAMERA_ORTHOGRAPHIC";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 0;
+            static const int value = 1;
             return &value;
          } else {
             return nullptr;
@@ -7746,7 +8768,7 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
             static const char *feature = "KHR_CAMERA_PERSPECTIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
+            static const int value = 2;
             return &value;
          } else {
             return nullptr;
@@ -7792,7 +8814,7 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
             static const char *feature = "KHR_GEOMETRY_CONE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 2;
+            static const int value = 3;
             return &value;
          } else {
             return nullptr;
@@ -7837,7 +8859,7 @@ static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoTy
             static const char *feature = "KHR_GEOMETRY_CURVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 3;
+            static const int value = 4;
             return &value;
          } else {
             return nullptr;
@@ -7884,7 +8906,7 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
             static const char *feature = "KHR_GEOMETRY_CYLINDER";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 4;
+            static const int value = 5;
             return &value;
          } else {
             return nullptr;
@@ -7929,7 +8951,7 @@ static const void * ANARI_GEOMETRY_quad_info(int infoName, ANARIDataType infoTyp
             static const char *feature = "KHR_GEOMETRY_QUAD";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 5;
+            static const int value = 6;
             return &value;
          } else {
             return nullptr;
@@ -7974,7 +8996,7 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
             static const char *feature = "KHR_GEOMETRY_SPHERE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 6;
+            static const int value = 7;
             return &value;
          } else {
             return nullptr;
@@ -8019,7 +9041,7 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
             static const char *feature = "KHR_GEOMETRY_TRIANGLE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 7;
+            static const int value = 8;
             return &value;
          } else {
             return nullptr;
@@ -8057,7 +9079,7 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
             static const char *feature = "KHR_MATERIAL_MATTE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 8;
+            static const int value = 9;
             return &value;
          } else {
             return nullptr;
@@ -8095,7 +9117,7 @@ static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoT
             static const char *feature = "KHR_SAMPLER_IMAGE1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 9;
+            static const int value = 10;
             return &value;
          } else {
             return nullptr;
@@ -8134,7 +9156,7 @@ static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoT
             static const char *feature = "KHR_SAMPLER_IMAGE2D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 10;
+            static const int value = 11;
             return &value;
          } else {
             return nullptr;
@@ -8174,7 +9196,7 @@ static const void * ANARI_SAMPLER_image3D_info(int infoName, ANARIDataType infoT
             static const char *feature = "KHR_SAMPLER_IMAGE3D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 11;
+            static const int value = 12;
             return &value;
          } else {
             return nullptr;
@@ -8206,7 +9228,7 @@ static const void * ANARI_SAMPLER_primitive_info(int infoName, ANARIDataType inf
             static const char *feature = "KHR_SAMPLER_PRIMITIVE";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 12;
+            static const int value = 13;
             return &value;
          } else {
             return nullptr;
@@ -8239,7 +9261,7 @@ static const void * ANARI_SAMPLER_transform_info(int infoName, ANARIDataType inf
             static const char *feature = "KHR_SAMPLER_TRANSFORM";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 13;
+            static const int value = 14;
             return &value;
          } else {
             return nullptr;
@@ -8273,7 +9295,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANA
             static const char *feature = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 14;
+            static const int value = 15;
             return &value;
          } else {
             return nullptr;
@@ -8311,7 +9333,7 @@ static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIData
             static const char *feature = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return feature;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 15;
+            static const int value = 16;
             return &value;
          } else {
             return nullptr;
@@ -8321,9 +9343,9 @@ static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIData
 }
 static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 8:
-         return ANARI_CAMERA_orthographic_info(infoName, infoType);
       case 9:
+         return ANARI_CAMERA_orthographic_info(infoName, infoType);
+      case 10:
          return ANARI_CAMERA_perspective_info(infoName, infoType);
       default:
          return nullptr;
@@ -8331,17 +9353,17 @@ static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDa
 }
 static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 0:
-         return ANARI_GEOMETRY_cone_info(infoName, infoType);
       case 1:
-         return ANARI_GEOMETRY_curve_info(infoName, infoType);
+         return ANARI_GEOMETRY_cone_info(infoName, infoType);
       case 2:
+         return ANARI_GEOMETRY_curve_info(infoName, infoType);
+      case 3:
          return ANARI_GEOMETRY_cylinder_info(infoName, infoType);
-      case 11:
-         return ANARI_GEOMETRY_quad_info(infoName, infoType);
       case 12:
+         return ANARI_GEOMETRY_quad_info(infoName, infoType);
+      case 13:
          return ANARI_GEOMETRY_sphere_info(infoName, infoType);
-      case 16:
+      case 17:
          return ANARI_GEOMETRY_triangle_info(infoName, infoType);
       default:
          return nullptr;
@@ -8349,7 +9371,7 @@ static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_MATERIAL_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 7:
+      case 8:
          return ANARI_MATERIAL_matte_info(infoName, infoType);
       default:
          return nullptr;
@@ -8357,23 +9379,25 @@ static const void * ANARI_MATERIAL_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_RENDERER_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 3:
+      case 4:
          return ANARI_RENDERER_default_info(infoName, infoType);
+      case 0:
+         return ANARI_RENDERER_ao_info(infoName, infoType);
       default:
          return nullptr;
    }
 }
 static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 4:
-         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 5:
-         return ANARI_SAMPLER_image2D_info(infoName, infoType);
+         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 6:
+         return ANARI_SAMPLER_image2D_info(infoName, infoType);
+      case 7:
          return ANARI_SAMPLER_image3D_info(infoName, infoType);
-      case 10:
+      case 11:
          return ANARI_SAMPLER_primitive_info(infoName, infoType);
-      case 15:
+      case 16:
          return ANARI_SAMPLER_transform_info(infoName, infoType);
       default:
          return nullptr;
@@ -8381,7 +9405,7 @@ static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARID
 }
 static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 13:
+      case 14:
          return ANARI_SPATIAL_FIELD_structuredRegular_info(infoName, infoType);
       default:
          return nullptr;
@@ -8389,7 +9413,7 @@ static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName,
 }
 static const void * ANARI_VOLUME_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 14:
+      case 15:
          return ANARI_VOLUME_transferFunction1D_info(infoName, infoType);
       default:
          return nullptr;
@@ -8413,22 +9437,22 @@ const void * query_object_info_enum(ANARIDataType type, const char *subtype, int
          return ANARI_VOLUME_info(subtype, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_info(infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_info(infoName, infoType);
+      case ANARI_SURFACE:
+         return ANARI_SURFACE_info(infoName, infoType);
+      case ANARI_INSTANCE:
+         return ANARI_INSTANCE_info(infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_info(infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_info(infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_info(infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_info(infoName, infoType);
       case ANARI_GROUP:
          return ANARI_GROUP_info(infoName, infoType);
-      case ANARI_INSTANCE:
-         return ANARI_INSTANCE_info(infoName, infoType);
       case ANARI_WORLD:
          return ANARI_WORLD_info(infoName, infoType);
-      case ANARI_SURFACE:
-         return ANARI_SURFACE_info(infoName, infoType);
       default:
          return nullptr;
    }
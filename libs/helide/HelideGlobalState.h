@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "DeduplicationCache.h"
 #include "helide_math.h"
 // helium
 #include "helium/BaseGlobalDeviceState.h"
@@ -40,6 +41,7 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
     helium::TimeStamp lastBLSReconstructSceneRequest{0};
     helium::TimeStamp lastBLSCommitSceneRequest{0};
     helium::TimeStamp lastTLSReconstructSceneRequest{0};
+    helium::TimeStamp lastHitRecordsRebuildRequest{0};
   } objectUpdates;
 
   Frame *currentFrame{nullptr};
@@ -49,6 +51,9 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
   bool allowInvalidSurfaceMaterials{true};
   float4 invalidMaterialColor{1.f, 0.f, 1.f, 1.f};
 
+  bool deduplicateData{false};
+  DeduplicationCache dedupCache;
+
   // Helper methods //
 
   HelideGlobalState(ANARIDevice d);
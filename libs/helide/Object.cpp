@@ -8,6 +8,37 @@
 
 namespace helide {
 
+helium::SlabAllocator &objectAllocator()
+{
+  // Never destroyed, objects may outlive static destructors
+  static auto *allocator = new helium::SlabAllocator();
+  return *allocator;
+}
+
+// SlabAllocated definitions //////////////////////////////////////////////////
+
+void *SlabAllocated::operator new(size_t size)
+{
+  return objectAllocator().allocate(size);
+}
+
+void *SlabAllocated::operator new(size_t size, std::align_val_t alignment)
+{
+  // Blocks are only aligned to SlabAllocator::BLOCK_ALIGNMENT
+  return ::operator new(size, alignment);
+}
+
+void SlabAllocated::operator delete(void *ptr, size_t size)
+{
+  objectAllocator().free(ptr, size);
+}
+
+void SlabAllocated::operator delete(
+    void *ptr, size_t size, std::align_val_t alignment)
+{
+  ::operator delete(ptr, size, alignment);
+}
+
 // Object definitions /////////////////////////////////////////////////////////
 
 Object::Object(ANARIDataType type, HelideGlobalState *s)
@@ -35,6 +66,11 @@ bool Object::isValid() const
   return true;
 }
 
+void Object::arrayRegionChanged(const Array *, size_t, size_t)
+{
+  markUpdated();
+}
+
 HelideGlobalState *Object::deviceState() const
 {
   return (HelideGlobalState *)helium::BaseObject::m_state;
@@ -7,12 +7,30 @@
 #include "helide_math.h"
 // helium
 #include "helium/BaseObject.h"
+#include "helium/utility/SlabAllocator.h"
 // std
+#include <new>
 #include <string_view>
 
 namespace helide {
 
-struct Object : public helium::BaseObject
+struct Array;
+
+// Slab allocator for objects and arrays of all helide devices in the process
+helium::SlabAllocator &objectAllocator();
+
+// Gives derived classes operator new/delete using objectAllocator(), so large
+// scenes don't fragment the heap with millions of small objects
+struct SlabAllocated
+{
+  static void *operator new(size_t size);
+  static void *operator new(size_t size, std::align_val_t alignment);
+  static void operator delete(void *ptr, size_t size);
+  static void operator delete(
+      void *ptr, size_t size, std::align_val_t alignment);
+};
+
+struct Object : public helium::BaseObject, public SlabAllocated
 {
   Object(ANARIDataType type, HelideGlobalState *s);
   virtual ~Object() = default;
@@ -26,6 +44,11 @@ struct Object : public helium::BaseObject
 
   virtual bool isValid() const;
 
+  // Called instead of markUpdated() when an observed array was unmapped with
+  // only elements [begin, end) changed. Objects which can update just that
+  // part of their state override this, by default it is a full update.
+  virtual void arrayRegionChanged(const Array *array, size_t begin, size_t end);
+
   HelideGlobalState *deviceState() const;
 };
 
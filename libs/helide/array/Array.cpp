@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "array/Array.h"
+// helium
+#include "helium/utility/FileMapping.h"
+// std
+#include <algorithm>
 
 namespace helide {
 
@@ -44,6 +48,8 @@ Array::Array(ANARIDataType type,
 
 Array::~Array()
 {
+  // Arrays released without being used still hand over their memory
+  captureSharedMemory();
   freeAppMemory();
   deviceState()->objectCounts.arrays--;
 }
@@ -91,7 +97,7 @@ bool Array::getProperty(
 
 void Array::commit()
 {
-  // no-op
+  updateFileMapping();
 }
 
 void *Array::map()
@@ -102,6 +108,7 @@ void *Array::map()
   }
   m_mapped = true;
   deviceState()->waitOnCurrentFrame();
+  uninternManagedMemory();
   return data();
 }
 
@@ -113,7 +120,31 @@ void Array::unmap()
     return;
   }
   m_mapped = false;
+
+  // Parameters are read directly, 'dirtyRegion' applies to this unmap only
+  uint64_t region[2] = {0, 0};
+  bool partial = !anari::isObject(elementType())
+      && getParam("dirtyRegion", ANARI_UINT64_REGION1, region);
+  removeParam("dirtyRegion");
+
+  const void *oldData = data();
+  if (deviceState()->deduplicateData)
+    internManagedMemory();
+
+  // Re-interned data moved, so observers have to pick up the new pointer
+  partial = partial && data() == oldData;
+  if (partial) {
+    m_changedBegin = std::min(size_t(region[0]), totalCapacity());
+    m_changedEnd = std::min(size_t(region[1]), totalCapacity());
+    if (m_changedBegin >= m_changedEnd) {
+      reportMessage(ANARI_SEVERITY_DEBUG,
+          "array unmapped with an empty 'dirtyRegion', nothing to update");
+      return;
+    }
+  }
+
   notifyCommitObservers();
+  m_changedBegin = m_changedEnd = 0;
 }
 
 bool Array::wasPrivatized() const
@@ -132,6 +163,16 @@ void Array::makePrivatizedCopy(size_t numElements)
     return;
 
   if (!anari::isObject(elementType())) {
+    // Parameters are read directly, so they don't need to be committed first
+    if (getParam<bool>("readOnly", false)) {
+      reportMessage(ANARI_SEVERITY_DEBUG,
+          "released shared array is read-only, keeping application memory");
+      return;
+    }
+
+    if (captureSharedMemory())
+      return;
+
     reportMessage(ANARI_SEVERITY_PERFORMANCE_WARNING,
         "making private copy of shared array (type '%s') | ownership: (%i:%i)",
         anari::toString(elementType()),
@@ -145,6 +186,29 @@ void Array::makePrivatizedCopy(size_t numElements)
 
   m_privatized = true;
   zeroOutStruct(m_hostData.shared);
+
+  // Objects may have handed the shared pointer to Embree, so they need to
+  // re-commit against the privatized copy
+  notifyCommitObservers();
+}
+
+bool Array::captureSharedMemory()
+{
+  auto deleter = getParam<ANARIMemoryDeleter>("releaseDeleter", nullptr);
+  if (ownership() != ArrayDataOwnership::SHARED || wasPrivatized() || !deleter)
+    return false;
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "capturing application memory of released shared array");
+
+  auto &captured = m_hostData.captured;
+  captured.mem = m_hostData.shared.mem;
+  captured.deleter = deleter;
+  captured.deleterPtr =
+      getParam<const void *>("releaseDeleterUserData", nullptr);
+  zeroOutStruct(m_hostData.shared);
+  m_ownership = ArrayDataOwnership::CAPTURED;
+  return true;
 }
 
 void Array::freeAppMemory()
@@ -157,7 +221,11 @@ void Array::freeAppMemory()
     zeroOutStruct(captured);
   } else if (ownership() == ArrayDataOwnership::MANAGED) {
     reportMessage(ANARI_SEVERITY_DEBUG, "freeing managed array");
-    free(m_hostData.managed.mem);
+    if (m_interned)
+      deviceState()->dedupCache.releaseArrayData(m_hostData.managed.mem);
+    else
+      free(m_hostData.managed.mem);
+    m_interned = false;
     zeroOutStruct(m_hostData.managed);
   } else if (wasPrivatized()) {
     free(m_hostData.privatized.mem);
@@ -171,15 +239,93 @@ void Array::initManagedMemory()
     return;
 
   if (ownership() == ArrayDataOwnership::MANAGED) {
+    // calloc() leaves large arrays untouched until written, so arrays which
+    // get mapped from a file never page in their managed memory
     auto totalBytes = totalSize() * anari::sizeOf(elementType());
-    m_hostData.managed.mem = malloc(totalBytes);
-    std::memset(data(), 0, totalBytes);
+    m_hostData.managed.mem = calloc(totalBytes, 1);
   }
 }
 
+void Array::internManagedMemory()
+{
+  if (m_interned || ownership() != ArrayDataOwnership::MANAGED
+      || anari::isObject(elementType()) || !m_hostData.managed.mem)
+    return;
+
+  auto totalBytes = totalCapacity() * anari::sizeOf(elementType());
+  m_hostData.managed.mem = deviceState()->dedupCache.internArrayData(
+      m_hostData.managed.mem, totalBytes);
+  m_interned = true;
+}
+
+void Array::uninternManagedMemory()
+{
+  if (!m_interned)
+    return;
+
+  // Interned memory may be shared with other arrays, so writes go to a copy
+  auto totalBytes = totalCapacity() * anari::sizeOf(elementType());
+  void *mem = malloc(totalBytes);
+  std::memcpy(mem, m_hostData.managed.mem, totalBytes);
+  deviceState()->dedupCache.releaseArrayData(m_hostData.managed.mem);
+  m_hostData.managed.mem = mem;
+  m_interned = false;
+}
+
+void Array::updateFileMapping()
+{
+  auto file = getParamString("file", "");
+  auto offset = getParam<uint64_t>("fileOffset", 0);
+  if (file.empty() || anari::isObject(elementType())
+      || (file == m_mappedFile && offset == m_mappedFileOffset))
+    return;
+
+  if (m_mapped) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "array 'file' ignored while the array is mapped");
+    return;
+  }
+
+  // Arrays are committed before the objects reading them, but a frame still
+  // rendering may use the current data, which is freed below
+  deviceState()->waitOnCurrentFrame();
+
+  auto numBytes = totalCapacity() * anari::sizeOf(elementType());
+  const void *deleterPtr = nullptr;
+  std::string error;
+  void *mem =
+      helium::mapFile(file.c_str(), offset, numBytes, &deleterPtr, error);
+  if (!mem) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "unable to map array 'file' (%s): %s",
+        file.c_str(),
+        error.c_str());
+    return;
+  }
+
+  freeAppMemory();
+  zeroOutStruct(m_hostData);
+  m_privatized = false;
+
+  m_ownership = ArrayDataOwnership::CAPTURED;
+  m_hostData.captured.mem = mem;
+  m_hostData.captured.deleter = helium::unmapFile;
+  m_hostData.captured.deleterPtr = deleterPtr;
+
+  m_mappedFile = file;
+  m_mappedFileOffset = offset;
+
+  notifyCommitObservers();
+}
+
 void Array::notifyObserver(BaseObject *o) const
 {
-  o->markUpdated();
+  auto *obj =
+      m_changedEnd > m_changedBegin ? dynamic_cast<Object *>(o) : nullptr;
+  if (obj)
+    obj->arrayRegionChanged(this, m_changedBegin, m_changedEnd);
+  else
+    o->markUpdated();
   deviceState()->commitBuffer.addObject(o);
 }
 
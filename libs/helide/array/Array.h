@@ -27,7 +27,7 @@ struct ArrayMemoryDescriptor
   ANARIDataType elementType{ANARI_UNKNOWN};
 };
 
-struct Array : public helium::BaseArray
+struct Array : public helium::BaseArray, public SlabAllocated
 {
   Array(ANARIDataType type,
       HelideGlobalState *state,
@@ -62,8 +62,12 @@ struct Array : public helium::BaseArray
 
  protected:
   void makePrivatizedCopy(size_t numElements);
+  bool captureSharedMemory();
   void freeAppMemory();
   void initManagedMemory();
+  void internManagedMemory();
+  void uninternManagedMemory();
+  void updateFileMapping();
 
   void notifyObserver(BaseObject *) const override;
 
@@ -98,6 +102,12 @@ struct Array : public helium::BaseArray
   ArrayDataOwnership m_ownership{ArrayDataOwnership::INVALID};
   ANARIDataType m_elementType{ANARI_UNKNOWN};
   bool m_privatized{false};
+  bool m_interned{false};
+  // Elements changed by the unmap() currently notifying observers, if known
+  size_t m_changedBegin{0};
+  size_t m_changedEnd{0};
+  std::string m_mappedFile;
+  uint64_t m_mappedFileOffset{0};
   mutable bool m_usedOnDevice{false};
 };
 
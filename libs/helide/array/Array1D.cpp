@@ -13,6 +13,8 @@ Array1D::Array1D(HelideGlobalState *state, const Array1DMemoryDescriptor &d)
 
 void Array1D::commit()
 {
+  Array::commit();
+
   auto oldBegin = m_begin;
   auto oldEnd = m_end;
 
@@ -71,6 +73,11 @@ float4 Array1D::readAsAttributeValue(int32_t i, WrapMode wrap) const
   return readAsAttributeValueFlat(begin(), elementType(), idx);
 }
 
+AttributeAccessor Array1D::attributeAccessor() const
+{
+  return AttributeAccessor(begin(), elementType(), size());
+}
+
 void Array1D::privatize()
 {
   makePrivatizedCopy(size());
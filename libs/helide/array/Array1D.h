@@ -4,6 +4,7 @@
 #pragma once
 
 #include "array/Array.h"
+#include "array/AttributeAccessor.h"
 
 namespace helide {
 
@@ -35,6 +36,7 @@ struct Array1D : public Array
 
   float4 readAsAttributeValue(
       int32_t i, WrapMode wrap = WrapMode::DEFAULT) const;
+  AttributeAccessor attributeAccessor() const;
   template <typename T>
   T valueAtLinear(float in) const; // 'in' must be clamped to [0, 1]
   template <typename T>
@@ -38,6 +38,11 @@ float4 Array2D::readAsAttributeValue(
   return readAsAttributeValueFlat(data(), elementType(), idx);
 }
 
+AttributeAccessor Array2D::attributeAccessor() const
+{
+  return AttributeAccessor(data(), elementType(), totalSize());
+}
+
 void Array2D::privatize()
 {
   makePrivatizedCopy(size(0) * size(1));
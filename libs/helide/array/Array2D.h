@@ -4,6 +4,7 @@
 #pragma once
 
 #include "array/Array.h"
+#include "array/AttributeAccessor.h"
 
 namespace helide {
 
@@ -27,6 +28,7 @@ struct Array2D : public Array
   float4 readAsAttributeValue(int2 i,
       WrapMode wrap1 = WrapMode::DEFAULT,
       WrapMode wrap2 = WrapMode::DEFAULT) const;
+  AttributeAccessor attributeAccessor() const;
 
   void privatize() override;
 
@@ -41,6 +41,11 @@ float4 Array3D::readAsAttributeValue(
   return readAsAttributeValueFlat(data(), elementType(), idx);
 }
 
+AttributeAccessor Array3D::attributeAccessor() const
+{
+  return AttributeAccessor(data(), elementType(), totalSize());
+}
+
 void Array3D::privatize()
 {
   makePrivatizedCopy(size(0) * size(1) * size(2));
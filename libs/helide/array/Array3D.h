@@ -4,6 +4,7 @@
 #pragma once
 
 #include "array/Array.h"
+#include "array/AttributeAccessor.h"
 
 namespace helide {
 
@@ -29,6 +30,7 @@ struct Array3D : public Array
       WrapMode wrap1 = WrapMode::DEFAULT,
       WrapMode wrap2 = WrapMode::DEFAULT,
       WrapMode wrap3 = WrapMode::DEFAULT) const;
+  AttributeAccessor attributeAccessor() const;
 
   void privatize() override;
 
@@ -0,0 +1,229 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "helide_math.h"
+// std
+#include <algorithm>
+
+namespace helide {
+
+// Reads element 'i' of an attribute array as float4
+using AttributeReadFcn = float4 (*)(const void *data, uint64_t i);
+// Writes a float4 to element 'i' of an attribute array, inverse of the above
+using AttributeWriteFcn = void (*)(void *data, uint64_t i, const float4 &v);
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+inline float4 readDefaultAttribute(const void *, uint64_t)
+{
+  return DEFAULT_ATTRIBUTE_VALUE;
+}
+
+template <int NUM_COMPONENTS>
+inline float4 readFloatAttribute(const void *data, uint64_t i)
+{
+  auto retval = DEFAULT_ATTRIBUTE_VALUE;
+  std::memcpy(&retval,
+      typedOffset<float>(data, NUM_COMPONENTS * i),
+      NUM_COMPONENTS * sizeof(float));
+  return retval;
+}
+
+template <int NUM_COMPONENTS>
+inline float4 readHalfAttribute(const void *data, uint64_t i)
+{
+  auto retval = DEFAULT_ATTRIBUTE_VALUE;
+  const auto *h = typedOffset<uint16_t>(data, NUM_COMPONENTS * i);
+  for (int c = 0; c < NUM_COMPONENTS; c++)
+    retval[c] = halfToFloat(h[c]);
+  return retval;
+}
+
+template <typename ELEMENT_T, int NUM_COMPONENTS, bool SRGB = false>
+inline float4 readUFixedAttribute(const void *data, uint64_t i)
+{
+  return getAttributeArrayAt_ufixed<ELEMENT_T, NUM_COMPONENTS, SRGB>(
+      const_cast<void *>(data), i);
+}
+
+template <int NUM_COMPONENTS>
+inline void writeFloatAttribute(void *data, uint64_t i, const float4 &v)
+{
+  std::memcpy((float *)data + NUM_COMPONENTS * i,
+      &v,
+      NUM_COMPONENTS * sizeof(float));
+}
+
+template <int NUM_COMPONENTS>
+inline void writeHalfAttribute(void *data, uint64_t i, const float4 &v)
+{
+  auto *h = (uint16_t *)data + NUM_COMPONENTS * i;
+  for (int c = 0; c < NUM_COMPONENTS; c++)
+    h[c] = floatToHalf(v[c]);
+}
+
+template <typename ELEMENT_T, int NUM_COMPONENTS, bool SRGB = false>
+inline void writeUFixedAttribute(void *data, uint64_t i, const float4 &v)
+{
+  constexpr float m = std::numeric_limits<ELEMENT_T>::max();
+  auto *out = (ELEMENT_T *)data + NUM_COMPONENTS * i;
+  for (int c = 0; c < NUM_COMPONENTS; c++) {
+    const float f = std::clamp(inverseToneMap<SRGB>(v[c]), 0.f, 1.f);
+    out[c] = ELEMENT_T(double(f) * m + 0.5);
+  }
+}
+
+// Same element types as readAsAttributeValueFlat() plus 16-bit floats,
+// resolved once up front
+inline AttributeReadFcn attributeReaderFor(ANARIDataType type)
+{
+  switch (type) {
+  case ANARI_FLOAT32:
+    return readFloatAttribute<1>;
+  case ANARI_FLOAT32_VEC2:
+    return readFloatAttribute<2>;
+  case ANARI_FLOAT32_VEC3:
+    return readFloatAttribute<3>;
+  case ANARI_FLOAT32_VEC4:
+    return readFloatAttribute<4>;
+  case ANARI_FLOAT16:
+    return readHalfAttribute<1>;
+  case ANARI_FLOAT16_VEC2:
+    return readHalfAttribute<2>;
+  case ANARI_FLOAT16_VEC3:
+    return readHalfAttribute<3>;
+  case ANARI_FLOAT16_VEC4:
+    return readHalfAttribute<4>;
+  case ANARI_UFIXED8_R_SRGB:
+    return readUFixedAttribute<uint8_t, 1, true>;
+  case ANARI_UFIXED8_RA_SRGB:
+    return readUFixedAttribute<uint8_t, 2, true>;
+  case ANARI_UFIXED8_RGB_SRGB:
+    return readUFixedAttribute<uint8_t, 3, true>;
+  case ANARI_UFIXED8_RGBA_SRGB:
+    return readUFixedAttribute<uint8_t, 4, true>;
+  case ANARI_UFIXED8:
+    return readUFixedAttribute<uint8_t, 1>;
+  case ANARI_UFIXED8_VEC2:
+    return readUFixedAttribute<uint8_t, 2>;
+  case ANARI_UFIXED8_VEC3:
+    return readUFixedAttribute<uint8_t, 3>;
+  case ANARI_UFIXED8_VEC4:
+    return readUFixedAttribute<uint8_t, 4>;
+  case ANARI_UFIXED16:
+    return readUFixedAttribute<uint16_t, 1>;
+  case ANARI_UFIXED16_VEC2:
+    return readUFixedAttribute<uint16_t, 2>;
+  case ANARI_UFIXED16_VEC3:
+    return readUFixedAttribute<uint16_t, 3>;
+  case ANARI_UFIXED16_VEC4:
+    return readUFixedAttribute<uint16_t, 4>;
+  case ANARI_UFIXED32:
+    return readUFixedAttribute<uint32_t, 1>;
+  case ANARI_UFIXED32_VEC2:
+    return readUFixedAttribute<uint32_t, 2>;
+  case ANARI_UFIXED32_VEC3:
+    return readUFixedAttribute<uint32_t, 3>;
+  case ANARI_UFIXED32_VEC4:
+    return readUFixedAttribute<uint32_t, 4>;
+  default:
+    return readDefaultAttribute;
+  }
+}
+
+// Null for element types which cannot be read as attributes
+inline AttributeWriteFcn attributeWriterFor(ANARIDataType type)
+{
+  switch (type) {
+  case ANARI_FLOAT32:
+    return writeFloatAttribute<1>;
+  case ANARI_FLOAT32_VEC2:
+    return writeFloatAttribute<2>;
+  case ANARI_FLOAT32_VEC3:
+    return writeFloatAttribute<3>;
+  case ANARI_FLOAT32_VEC4:
+    return writeFloatAttribute<4>;
+  case ANARI_FLOAT16:
+    return writeHalfAttribute<1>;
+  case ANARI_FLOAT16_VEC2:
+    return writeHalfAttribute<2>;
+  case ANARI_FLOAT16_VEC3:
+    return writeHalfAttribute<3>;
+  case ANARI_FLOAT16_VEC4:
+    return writeHalfAttribute<4>;
+  case ANARI_UFIXED8_R_SRGB:
+    return writeUFixedAttribute<uint8_t, 1, true>;
+  case ANARI_UFIXED8_RA_SRGB:
+    return writeUFixedAttribute<uint8_t, 2, true>;
+  case ANARI_UFIXED8_RGB_SRGB:
+    return writeUFixedAttribute<uint8_t, 3, true>;
+  case ANARI_UFIXED8_RGBA_SRGB:
+    return writeUFixedAttribute<uint8_t, 4, true>;
+  case ANARI_UFIXED8:
+    return writeUFixedAttribute<uint8_t, 1>;
+  case ANARI_UFIXED8_VEC2:
+    return writeUFixedAttribute<uint8_t, 2>;
+  case ANARI_UFIXED8_VEC3:
+    return writeUFixedAttribute<uint8_t, 3>;
+  case ANARI_UFIXED8_VEC4:
+    return writeUFixedAttribute<uint8_t, 4>;
+  case ANARI_UFIXED16:
+    return writeUFixedAttribute<uint16_t, 1>;
+  case ANARI_UFIXED16_VEC2:
+    return writeUFixedAttribute<uint16_t, 2>;
+  case ANARI_UFIXED16_VEC3:
+    return writeUFixedAttribute<uint16_t, 3>;
+  case ANARI_UFIXED16_VEC4:
+    return writeUFixedAttribute<uint16_t, 4>;
+  case ANARI_UFIXED32:
+    return writeUFixedAttribute<uint32_t, 1>;
+  case ANARI_UFIXED32_VEC2:
+    return writeUFixedAttribute<uint32_t, 2>;
+  case ANARI_UFIXED32_VEC3:
+    return writeUFixedAttribute<uint32_t, 3>;
+  case ANARI_UFIXED32_VEC4:
+    return writeUFixedAttribute<uint32_t, 4>;
+  default:
+    return nullptr;
+  }
+}
+
+// Attribute array data + element type, resolved to a typed read function when
+// an object is committed so per-sample reads don't switch over element types.
+// Indices are clamped to the array size.
+struct AttributeAccessor
+{
+  AttributeAccessor() = default;
+  AttributeAccessor(const void *data, ANARIDataType type, size_t size);
+
+  float4 operator()(uint64_t i) const;
+  explicit operator bool() const;
+
+ private:
+  const void *m_data{nullptr};
+  AttributeReadFcn m_read{readDefaultAttribute};
+  uint64_t m_last{0};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline AttributeAccessor::AttributeAccessor(
+    const void *data, ANARIDataType type, size_t size)
+    : m_data(size ? data : nullptr),
+      m_read(size ? attributeReaderFor(type) : readDefaultAttribute),
+      m_last(size ? size - 1 : 0)
+{}
+
+inline float4 AttributeAccessor::operator()(uint64_t i) const
+{
+  return m_read(m_data, std::min(i, m_last));
+}
+
+inline AttributeAccessor::operator bool() const
+{
+  return m_data != nullptr;
+}
+
+} // namespace helide
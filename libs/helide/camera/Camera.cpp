@@ -36,6 +36,11 @@ void Camera::commit()
   markUpdated();
 }
 
+float2 Camera::rayCone(uint32_t) const
+{
+  return float2(0.f);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Camera *);
@@ -18,6 +18,9 @@ struct Camera : public Object
       std::string_view type, HelideGlobalState *state);
 
   virtual Ray createRay(const float2 &screen) const = 0;
+  // Pixel footprint at the ray origin (x) and its growth per unit distance
+  // (y), used to set up Ray::coneWidth/coneSpread
+  virtual float2 rayCone(uint32_t imageHeight) const;
 
  protected:
   float3 m_pos;
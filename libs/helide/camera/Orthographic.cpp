@@ -29,4 +29,9 @@ Ray Orthographic::createRay(const float2 &screen) const
   return ray;
 }
 
+float2 Orthographic::rayCone(uint32_t imageHeight) const
+{
+  return float2(length(m_pos_dv) / imageHeight, 0.f);
+}
+
 } // namespace helide
@@ -14,6 +14,7 @@ struct Orthographic : public Camera
   void commit() override;
 
   Ray createRay(const float2 &screen) const override;
+  float2 rayCone(uint32_t imageHeight) const override;
 
  private:
    float3 m_pos_du;
@@ -20,6 +20,7 @@ void Perspective::commit()
   float2 imgPlaneSize;
   imgPlaneSize.y = 2.f * tanf(0.5f * fovy);
   imgPlaneSize.x = imgPlaneSize.y * aspect;
+  m_imgPlaneHeight = imgPlaneSize.y;
 
   m_dir_du = normalize(cross(m_dir, m_up)) * imgPlaneSize.x;
   m_dir_dv = normalize(cross(m_dir_du, m_dir)) * imgPlaneSize.y;
@@ -34,4 +35,9 @@ Ray Perspective::createRay(const float2 &screen) const
   return ray;
 }
 
+float2 Perspective::rayCone(uint32_t imageHeight) const
+{
+  return float2(0.f, m_imgPlaneHeight / imageHeight);
+}
+
 } // namespace helide
@@ -14,11 +14,13 @@ struct Perspective : public Camera
   void commit() override;
 
   Ray createRay(const float2 &screen) const override;
+  float2 rayCone(uint32_t imageHeight) const override;
 
  private:
    float3 m_dir_du;
    float3 m_dir_dv;
    float3 m_dir_00;
+   float m_imgPlaneHeight{0.f};
 };
 
 } // namespace helide
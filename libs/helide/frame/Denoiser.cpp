@@ -0,0 +1,138 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Denoiser.h"
+// std
+#include <algorithm>
+#include <cmath>
+// embree
+#include "algorithms/parallel_for.h"
+
+namespace helide {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+static constexpr int NUM_PASSES = 5;
+static constexpr float KERNEL[3] = {3.f / 8.f, 1.f / 4.f, 1.f / 16.f};
+static constexpr float NORMAL_SIGMA = 0.2f;
+static constexpr float ALBEDO_SIGMA = 0.1f;
+static constexpr float DEPTH_SIGMA = 0.05f; // relative to the center depth
+static constexpr float ALBEDO_EPSILON = 1e-3f;
+
+static float3 safeAlbedo(const float3 &a)
+{
+  return float3(a.x < ALBEDO_EPSILON ? 1.f : a.x,
+      a.y < ALBEDO_EPSILON ? 1.f : a.y,
+      a.z < ALBEDO_EPSILON ? 1.f : a.z);
+}
+
+static float luminance(const float4 &c)
+{
+  return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
+// Denoiser definitions ///////////////////////////////////////////////////////
+
+void Denoiser::resize(const uint2 &size)
+{
+  m_size = size;
+  const size_t n = size_t(size.x) * size.y;
+  m_color.resize(n);
+  m_scratch.resize(n);
+  m_guides.resize(n);
+}
+
+void Denoiser::setSample(size_t i, const float4 &color, const PixelSample &s)
+{
+  auto &g = m_guides[i];
+  g.normal = s.normal;
+  g.albedo = safeAlbedo(s.albedo);
+  g.depth = s.depth;
+
+  m_color[i] = float4(float3(color.x, color.y, color.z) / g.albedo, color.w);
+}
+
+void Denoiser::run()
+{
+  if (m_color.empty())
+    return;
+
+  // Scale the color edge stopping function to the image content
+  float maxLuminance = 0.f;
+  for (const auto &c : m_color)
+    maxLuminance = std::max(maxLuminance, luminance(c));
+  float colorSigma = 0.25f * std::max(maxLuminance, 1e-3f);
+
+  for (int pass = 0; pass < NUM_PASSES; pass++) {
+    filterPass(m_color, m_scratch, 1 << pass, colorSigma);
+    std::swap(m_color, m_scratch);
+    colorSigma *= 0.5f;
+  }
+
+  embree::parallel_for(m_size.y, [&](int y) {
+    for (uint32_t x = 0; x < m_size.x; x++) {
+      const size_t i = size_t(y) * m_size.x + x;
+      const auto &a = m_guides[i].albedo;
+      m_color[i] = float4(float3(m_color[i].x, m_color[i].y, m_color[i].z) * a,
+          m_color[i].w);
+    }
+  });
+}
+
+void Denoiser::filterPass(const std::vector<float4> &in,
+    std::vector<float4> &out,
+    int step,
+    float colorSigma) const
+{
+  const int w = int(m_size.x);
+  const int h = int(m_size.y);
+  const float invColorSigma2 = 1.f / (colorSigma * colorSigma);
+  const float invNormalSigma2 = 1.f / (NORMAL_SIGMA * NORMAL_SIGMA);
+  const float invAlbedoSigma2 = 1.f / (ALBEDO_SIGMA * ALBEDO_SIGMA);
+
+  embree::parallel_for(h, [&](int y) {
+    for (int x = 0; x < w; x++) {
+      const size_t ci = size_t(y) * w + x;
+      const auto &cc = in[ci];
+      const auto &cg = m_guides[ci];
+      const float invDepthSigma =
+          1.f / (DEPTH_SIGMA * std::max(std::abs(cg.depth), 1e-3f));
+
+      float4 sum(0.f);
+      float weightSum = 0.f;
+
+      for (int dy = -2; dy <= 2; dy++) {
+        const int sy = y + dy * step;
+        if (sy < 0 || sy >= h)
+          continue;
+        for (int dx = -2; dx <= 2; dx++) {
+          const int sx = x + dx * step;
+          if (sx < 0 || sx >= w)
+            continue;
+
+          const size_t si = size_t(sy) * w + sx;
+          const auto &sc = in[si];
+          const auto &sg = m_guides[si];
+
+          const float4 dc = sc - cc;
+          const float3 dn = sg.normal - cg.normal;
+          const float3 da = sg.albedo - cg.albedo;
+          const float dz = std::abs(sg.depth - cg.depth) * invDepthSigma;
+
+          const float e = dot(dc, dc) * invColorSigma2
+              + dot(dn, dn) * invNormalSigma2 + dot(da, da) * invAlbedoSigma2
+              + dz * dz;
+          const float weight =
+              KERNEL[std::abs(dx)] * KERNEL[std::abs(dy)] * std::exp(-e);
+
+          sum += sc * weight;
+          weightSum += weight;
+        }
+      }
+
+      out[ci] = weightSum > 0.f ? sum / weightSum : cc;
+    }
+  });
+}
+
+} // namespace helide
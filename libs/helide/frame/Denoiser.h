@@ -0,0 +1,55 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "renderer/Renderer.h"
+// std
+#include <vector>
+
+namespace helide {
+
+// Edge-avoiding a-trous wavelet filter (Dammertz et al., HPG 2010) guided by
+// the normal, albedo and depth of the first surface hit. Color is divided by
+// albedo before filtering and multiplied back afterwards, so texture detail
+// is kept while the (untextured) illumination gets smoothed.
+struct Denoiser
+{
+  void resize(const uint2 &size);
+
+  // Store the input for pixel 'i' -- guides are taken from the normal,
+  // albedo and depth of 's'
+  void setSample(size_t i, const float4 &color, const PixelSample &s);
+
+  // Filter all pixels in parallel, results are read with color()
+  void run();
+
+  const float4 &color(size_t i) const;
+
+ private:
+  struct Guide
+  {
+    float3 normal;
+    float3 albedo;
+    float depth;
+  };
+
+  void filterPass(const std::vector<float4> &in,
+      std::vector<float4> &out,
+      int step,
+      float colorSigma) const;
+
+  uint2 m_size{0u};
+  std::vector<float4> m_color;
+  std::vector<float4> m_scratch;
+  std::vector<Guide> m_guides;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline const float4 &Denoiser::color(size_t i) const
+{
+  return m_color[i];
+}
+
+} // namespace helide
@@ -5,6 +5,7 @@
 // std
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <random>
 #include <thread>
 // embree
@@ -30,11 +31,56 @@ static uint32_t cvt_uint32_srgb(const float4 &v)
   return cvt_uint32(float4(toneMap(v.x), toneMap(v.y), toneMap(v.z), v.w));
 }
 
-template <typename I, typename FUNC>
-static void serial_for(I size, FUNC &&f)
+static int16_t cvt_int16(float f)
 {
-  for (I i = 0; i < size; i++)
-    f(i);
+  return static_cast<int16_t>(32767.f * std::clamp(f, -1.f, 1.f));
+}
+
+// Missed rays keep their initial 'tfar' as depth
+static bool isVisible(float depth)
+{
+  return depth < std::numeric_limits<float>::max();
+}
+
+static constexpr int TILE_SIZE = 16;
+static constexpr float MIN_RENDER_SCALE = 0.25f;
+static constexpr float UPSCALE_DEPTH_TOLERANCE = 0.05f; // relative
+static constexpr int PROGRESSIVE_BLOCK_SIZE = 8;
+
+// Calls 'fcn(x0, x1, y)' for each row of each tile
+template <typename FCN, typename STOP_FCN>
+static void parallelForTileRows(const uint2 &size, FCN &&fcn, STOP_FCN &&stop)
+{
+  const int numTilesX = (size.x + TILE_SIZE - 1) / TILE_SIZE;
+  const int numTilesY = (size.y + TILE_SIZE - 1) / TILE_SIZE;
+  embree::parallel_for(numTilesX * numTilesY, [&](int tile) {
+    if (stop())
+      return;
+    const int x0 = (tile % numTilesX) * TILE_SIZE;
+    const int y0 = (tile / numTilesX) * TILE_SIZE;
+    const int x1 = std::min(x0 + TILE_SIZE, int(size.x));
+    const int y1 = std::min(y0 + TILE_SIZE, int(size.y));
+    for (int y = y0; y < y1; y++)
+      fcn(x0, x1, y);
+  });
+}
+
+template <typename FCN, typename STOP_FCN>
+static void parallelForTiles(const uint2 &size, FCN &&fcn, STOP_FCN &&stop)
+{
+  parallelForTileRows(
+      size,
+      [&](int x0, int x1, int y) {
+        for (int x = x0; x < x1; x++)
+          fcn(x, y);
+      },
+      stop);
+}
+
+template <typename FCN>
+static void parallelForTiles(const uint2 &size, FCN &&fcn)
+{
+  parallelForTiles(size, std::forward<FCN>(fcn), []() { return false; });
 }
 
 template <typename R, typename TASK_T>
@@ -113,6 +159,76 @@ void Frame::commit()
   m_pixelBuffer.resize(numPixels * m_perPixelBytes);
 
   m_depthBuffer.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+
+  // Auxiliary channels //
+
+  auto getChannelType = [&](const char *name,
+                            std::initializer_list<anari::DataType> types) {
+    const auto type = getParam<anari::DataType>(name, ANARI_UNKNOWN);
+    if (type == ANARI_UNKNOWN
+        || std::find(types.begin(), types.end(), type) != types.end())
+      return type;
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unsupported type '%s' for '%s' on frame, channel is disabled",
+        anari::toString(type),
+        name);
+    return anari::DataType(ANARI_UNKNOWN);
+  };
+
+  m_normalType = getChannelType(
+      "channel.normal", {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3});
+  m_albedoType = getChannelType("channel.albedo",
+      {ANARI_FLOAT32_VEC3, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_RGB_SRGB});
+  const bool primitiveId =
+      getChannelType("channel.primitiveId", {ANARI_UINT32}) != ANARI_UNKNOWN;
+  const bool objectId =
+      getChannelType("channel.objectId", {ANARI_UINT32}) != ANARI_UNKNOWN;
+  const bool instanceId =
+      getChannelType("channel.instanceId", {ANARI_UINT32}) != ANARI_UNKNOWN;
+
+  m_auxChannels = AUX_NONE;
+  if (m_normalType != ANARI_UNKNOWN)
+    m_auxChannels |= AUX_NORMAL;
+  if (m_albedoType != ANARI_UNKNOWN)
+    m_auxChannels |= AUX_ALBEDO;
+  if (primitiveId)
+    m_auxChannels |= AUX_PRIMITIVE_ID;
+  if (objectId)
+    m_auxChannels |= AUX_OBJECT_ID;
+  if (instanceId)
+    m_auxChannels |= AUX_INSTANCE_ID;
+
+  m_normalBuffer.resize(
+      m_normalType != ANARI_UNKNOWN ? numPixels * anari::sizeOf(m_normalType)
+                                    : 0);
+  m_albedoBuffer.resize(
+      m_albedoType != ANARI_UNKNOWN ? numPixels * anari::sizeOf(m_albedoType)
+                                    : 0);
+  m_primitiveIdBuffer.resize(primitiveId ? numPixels : 0);
+  m_objectIdBuffer.resize(objectId ? numPixels : 0);
+  m_instanceIdBuffer.resize(instanceId ? numPixels : 0);
+
+  const bool visibility =
+      getChannelType("channel.visibility", {ANARI_UFIXED8}) != ANARI_UNKNOWN;
+  m_visibilityBuffer.resize(visibility ? numPixels : 0);
+
+  m_depthVisibilityOnly =
+      m_colorType == ANARI_UNKNOWN && m_auxChannels == AUX_NONE;
+
+  m_denoise =
+      getParam<bool>("denoise", false) && m_colorType != ANARI_UNKNOWN;
+  m_denoiser.resize(m_denoise ? m_frameData.size : uint2(0u));
+
+  m_targetFrameTime = getParam<float>("targetFrameTime", 0.f);
+  if (m_targetFrameTime <= 0.f) {
+    m_dynamicScale = 1.f;
+    m_scaledSamples.clear();
+    m_scaledSamples.shrink_to_fit();
+  }
+
+  m_progressive = getParam<bool>("progressive", false);
+  m_timeBudget = getParam<float>("progressive.timeBudget", 0.f);
+
   m_frameChanged = true;
 }
 
@@ -124,11 +240,79 @@ bool Frame::getProperty(
       wait();
     helium::writeToVoidP(ptr, m_duration);
     return true;
+  } else if (type == ANARI_FLOAT32 && name == "renderScale") {
+    if (flags & ANARI_WAIT)
+      wait();
+    helium::writeToVoidP(ptr, m_renderScale);
+    return true;
+  } else if (type == ANARI_UINT32 && name == "progressive.blockSize") {
+    if (flags & ANARI_WAIT)
+      wait();
+    std::lock_guard<std::mutex> lock(m_passMutex);
+    helium::writeToVoidP(ptr, m_blockSize);
+    return true;
+  } else if (name.substr(0, 5) == "pick.") {
+    return getPickProperty(name.substr(5), type, ptr, flags);
   }
 
   return 0;
 }
 
+bool Frame::getPickProperty(
+    const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
+{
+  auto *state = deviceState();
+  state->waitOnCurrentFrame();
+  if (flags & ANARI_WAIT) {
+    state->commitBuffer.flush();
+    if (m_world)
+      m_world->embreeSceneUpdate();
+  }
+
+  if (!isValid())
+    return false;
+
+  // The position is read directly, it does not need to be committed
+  const auto result = pick(getParam<float2>("pick.position", float2(0.5f)));
+
+  if (type == ANARI_UINT32 && name == "instanceId")
+    helium::writeToVoidP(ptr, result.instanceId);
+  else if (type == ANARI_UINT32 && name == "objectId")
+    helium::writeToVoidP(ptr, result.objectId);
+  else if (type == ANARI_UINT32 && name == "primitiveId")
+    helium::writeToVoidP(ptr, result.primitiveId);
+  else if (type == ANARI_FLOAT32_VEC3 && name == "worldPosition")
+    helium::writeToVoidP(ptr, result.position);
+  else if (type == ANARI_FLOAT32 && name == "depth")
+    helium::writeToVoidP(ptr, result.depth);
+  else
+    return false;
+
+  return true;
+}
+
+Frame::PickResult Frame::pick(const float2 &screen) const
+{
+  PickResult result;
+  if (!m_world->hasSurfaces())
+    return result;
+
+  Ray ray = m_camera->createRay(screen);
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+  rtcIntersect1(m_world->embreeScene(), &context, (RTCRayHit *)&ray);
+  if (ray.geomID == RTC_INVALID_GEOMETRY_ID)
+    return result;
+
+  const auto &hr = m_world->hitRecords();
+  result.instanceId = hr.instanceId(ray.instID);
+  result.objectId = hr.objectId(hr.index(ray.instID, ray.geomID));
+  result.primitiveId = ray.primID;
+  result.position = ray.org + ray.tfar * ray.dir;
+  result.depth = ray.tfar;
+  return result;
+}
+
 void Frame::renderFrame()
 {
   this->refInc(helium::RefType::INTERNAL);
@@ -148,27 +332,96 @@ void Frame::renderFrame()
     return;
   }
 
-  if (state->commitBuffer.lastFlush() <= m_frameLastRendered) {
+  const bool sceneChanged =
+      state->commitBuffer.lastFlush() > m_frameLastRendered;
+
+  const bool accumulate = m_renderer->isStochastic() && !m_depthVisibilityOnly;
+
+  // An unchanged scene is only rendered again to get rid of a reduced scale,
+  // to finish a progressive frame which was stopped early or to accumulate
+  if (!sceneChanged && m_renderScale == 1.f && m_frameComplete && !accumulate) {
     this->refDec(helium::RefType::INTERNAL);
     return;
   }
 
+  const bool restartAccumulation = !accumulate || sceneChanged
+      || !m_frameComplete || m_renderScale < 1.f;
+  if (restartAccumulation)
+    m_accumFrames = 0;
+  m_accumulate = accumulate;
+  m_accumBuffer.resize(
+      accumulate ? size_t(m_frameData.size.x) * m_frameData.size.y : 0);
+
+  m_renderScale =
+      sceneChanged && !m_depthVisibilityOnly ? m_dynamicScale : 1.f;
+
+  const bool progressive =
+      m_progressive && m_renderScale == 1.f && !m_depthVisibilityOnly;
+  m_discarded = false;
+  m_renderingProgressively = progressive;
+  if (progressive) {
+    std::lock_guard<std::mutex> lock(m_passMutex);
+    m_blockSize = 0;
+  }
+
   m_frameLastRendered = helium::newTimeStamp();
   state->currentFrame = this;
 
-  m_future = async<void>([&, state, start]() {
+  m_future = async<void>([&, state, start, progressive]() {
     m_world->embreeSceneUpdate();
 
     const auto &size = m_frameData.size;
-    embree::parallel_for(size.y, [&](int y) {
-      serial_for(size.x, [&](int x) {
+    const uint32_t sampleChannels =
+        m_auxChannels | (m_denoise ? AUX_NORMAL | AUX_ALBEDO : AUX_NONE);
+
+    m_frameComplete = true;
+    if (m_depthVisibilityOnly)
+      renderDepthVisibility();
+    else if (progressive)
+      m_frameComplete = renderProgressive(start, sampleChannels);
+    else if (m_renderScale == 1.f) {
+      const auto cone = m_camera->rayCone(size.y);
+      parallelForTiles(size, [&](int x, int y) {
         Ray ray = m_camera->createRay(screenFromPixel(float2(x, y)));
-        writeSample(x, y, m_renderer->renderSample(ray, *m_world));
+        ray.coneWidth = cone.x;
+        ray.coneSpread = cone.y;
+        ray.seed = sampleSeed(size_t(y) * size.x + x);
+        writeSample(
+            x, y, m_renderer->renderSample(ray, *m_world, sampleChannels));
       });
-    });
+    } else {
+      const auto scaledSize = renderSize();
+      const auto invScaledSize = 1.f / float2(scaledSize);
+      const auto cone = m_camera->rayCone(scaledSize.y);
+      m_scaledSamples.resize(size_t(scaledSize.x) * scaledSize.y);
+      parallelForTiles(scaledSize, [&](int x, int y) {
+        Ray ray = m_camera->createRay(float2(x, y) * invScaledSize);
+        ray.coneWidth = cone.x;
+        ray.coneSpread = cone.y;
+        ray.seed = sampleSeed(size_t(y) * scaledSize.x + x);
+        m_scaledSamples[size_t(y) * scaledSize.x + x] =
+            m_renderer->renderSample(ray, *m_world, sampleChannels);
+      });
+      upscaleSamples(scaledSize);
+    }
+
+    if (m_accumulate && m_frameComplete)
+      m_accumFrames++;
+
+    if (m_denoise && m_frameComplete) {
+      m_denoiser.run();
+      embree::parallel_for(size.y, [&](int y) {
+        for (uint32_t x = 0; x < size.x; x++) {
+          const size_t idx = size_t(y) * size.x + x;
+          writeColor(idx, m_denoiser.color(idx));
+        }
+      });
+    }
 
     auto end = std::chrono::steady_clock::now();
     m_duration = std::chrono::duration<float>(end - start).count();
+
+    updateRenderScale();
   });
 }
 
@@ -177,7 +430,12 @@ void *Frame::map(std::string_view channel,
     uint32_t *height,
     ANARIDataType *pixelType)
 {
-  wait();
+  // Reduced scale and depth/visibility only renders aren't progressive even
+  // with 'progressive' set, so they have no first pass to wait for
+  if (m_renderingProgressively)
+    waitForFirstPass();
+  else
+    wait();
 
   *width = m_frameData.size.x;
   *height = m_frameData.size.y;
@@ -188,6 +446,8 @@ void *Frame::map(std::string_view channel,
   } else if (channel == "depth" || channel == "channel.depth") {
     *pixelType = ANARI_FLOAT32;
     return mapDepthBuffer();
+  } else if (auto *buffer = mapAuxBuffer(channel, pixelType)) {
+    return buffer;
   } else {
     *width = 0;
     *height = 0;
@@ -213,7 +473,7 @@ int Frame::frameReady(ANARIWaitMask m)
 
 void Frame::discard()
 {
-  // no-op
+  m_discarded = true;
 }
 
 void *Frame::mapColorBuffer()
@@ -226,6 +486,34 @@ void *Frame::mapDepthBuffer()
   return m_depthBuffer.data();
 }
 
+void *Frame::mapAuxBuffer(std::string_view channel, ANARIDataType *pixelType)
+{
+  if (channel.substr(0, 8) == "channel.")
+    channel.remove_prefix(8);
+
+  auto mapIfEnabled = [&](auto &buffer, ANARIDataType type) -> void * {
+    if (buffer.empty())
+      return nullptr;
+    *pixelType = type;
+    return buffer.data();
+  };
+
+  if (channel == "normal")
+    return mapIfEnabled(m_normalBuffer, m_normalType);
+  else if (channel == "albedo")
+    return mapIfEnabled(m_albedoBuffer, m_albedoType);
+  else if (channel == "primitiveId")
+    return mapIfEnabled(m_primitiveIdBuffer, ANARI_UINT32);
+  else if (channel == "objectId")
+    return mapIfEnabled(m_objectIdBuffer, ANARI_UINT32);
+  else if (channel == "instanceId")
+    return mapIfEnabled(m_instanceIdBuffer, ANARI_UINT32);
+  else if (channel == "visibility")
+    return mapIfEnabled(m_visibilityBuffer, ANARI_UFIXED8);
+  else
+    return nullptr;
+}
+
 bool Frame::ready() const
 {
   return is_ready(m_future);
@@ -241,35 +529,298 @@ void Frame::wait() const
   }
 }
 
+void Frame::waitForFirstPass() const
+{
+  std::unique_lock<std::mutex> lock(m_passMutex);
+  m_passFinished.wait(lock, [&]() { return m_blockSize != 0; });
+}
+
 float2 Frame::screenFromPixel(const float2 &p) const
 {
   return p * m_frameData.invSize;
 }
 
+void Frame::updateRenderScale()
+{
+  if (m_targetFrameTime <= 0.f)
+    return;
+
+  // Cost is proportional to the pixel count, i.e. the square of the scale.
+  // Only move halfway towards the estimate to avoid oscillating.
+  const float estimate =
+      m_renderScale * std::sqrt(m_targetFrameTime / m_duration);
+  m_dynamicScale = std::clamp(
+      0.5f * (m_renderScale + estimate), MIN_RENDER_SCALE, 1.f);
+}
+
+uint2 Frame::renderSize() const
+{
+  const auto &size = m_frameData.size;
+  return uint2(std::max(1u, uint32_t(std::ceil(size.x * m_renderScale))),
+      std::max(1u, uint32_t(std::ceil(size.y * m_renderScale))));
+}
+
+void Frame::upscaleSamples(const uint2 &renderSize)
+{
+  // Bilinear interpolation of color between the four surrounding samples,
+  // where samples at a different depth than the nearest one are ignored so
+  // silhouettes stay sharp. All other values are taken from the nearest one.
+  const auto &size = m_frameData.size;
+  const float2 toScaled = float2(renderSize) / float2(size);
+  const int maxX = renderSize.x - 1;
+  const int maxY = renderSize.y - 1;
+  embree::parallel_for(size.y, [&](int y) {
+    const float sy = y * toScaled.y;
+    const int y0 = std::min(int(sy), maxY);
+    const int y1 = std::min(y0 + 1, maxY);
+    const float fy = sy - y0;
+    for (uint32_t x = 0; x < size.x; x++) {
+      const float sx = x * toScaled.x;
+      const int x0 = std::min(int(sx), maxX);
+      const int x1 = std::min(x0 + 1, maxX);
+      const float fx = sx - x0;
+
+      const PixelSample *taps[4] = {
+          &m_scaledSamples[size_t(y0) * renderSize.x + x0],
+          &m_scaledSamples[size_t(y0) * renderSize.x + x1],
+          &m_scaledSamples[size_t(y1) * renderSize.x + x0],
+          &m_scaledSamples[size_t(y1) * renderSize.x + x1]};
+      const float weights[4] = {(1.f - fx) * (1.f - fy),
+          fx * (1.f - fy),
+          (1.f - fx) * fy,
+          fx * fy};
+      const int nearest = (fx < 0.5f ? 0 : 1) + (fy < 0.5f ? 0 : 2);
+
+      PixelSample s = *taps[nearest];
+      const float tolerance = UPSCALE_DEPTH_TOLERANCE * s.depth;
+      float4 color(0.f);
+      float weightSum = 0.f;
+      for (int i = 0; i < 4; i++) {
+        if (std::abs(taps[i]->depth - s.depth) > tolerance)
+          continue;
+        color += weights[i] * taps[i]->color;
+        weightSum += weights[i];
+      }
+      if (weightSum > 0.f)
+        s.color = color / weightSum;
+      writeSample(x, y, s);
+    }
+  });
+}
+
+bool Frame::renderProgressive(
+    std::chrono::steady_clock::time_point start, uint32_t sampleChannels)
+{
+  const auto &size = m_frameData.size;
+  const auto cone = m_camera->rayCone(size.y);
+  const auto deadline = start
+      + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<float>(m_timeBudget));
+
+  auto stop = [&]() {
+    return m_discarded
+        || (m_timeBudget > 0.f && std::chrono::steady_clock::now() > deadline);
+  };
+
+  for (int block = PROGRESSIVE_BLOCK_SIZE; block >= 1; block /= 2) {
+    // The first pass always finishes so every pixel has a value
+    const bool first = block == PROGRESSIVE_BLOCK_SIZE;
+    auto stopPass = [&]() { return !first && stop(); };
+
+    const uint2 gridSize(
+        (size.x + block - 1) / block, (size.y + block - 1) / block);
+    parallelForTiles(
+        gridSize,
+        [&](int gx, int gy) {
+          // Points on the grid of the previous pass are traced already
+          if (!first && gx % 2 == 0 && gy % 2 == 0)
+            return;
+          const int x = gx * block;
+          const int y = gy * block;
+          Ray ray = m_camera->createRay(screenFromPixel(float2(x, y)));
+          ray.coneWidth = cone.x;
+          ray.coneSpread = cone.y;
+          ray.seed = sampleSeed(size_t(y) * size.x + x);
+          writeSample(
+              x, y, m_renderer->renderSample(ray, *m_world, sampleChannels));
+        },
+        stopPass);
+
+    if (stopPass())
+      return false;
+
+    if (block > 1)
+      fillBlocks(block);
+
+    {
+      std::lock_guard<std::mutex> lock(m_passMutex);
+      m_blockSize = block;
+    }
+    m_passFinished.notify_all();
+  }
+
+  return true;
+}
+
+void Frame::renderDepthVisibility()
+{
+  const auto &size = m_frameData.size;
+  const bool depth = !m_depthBuffer.empty();
+  const bool visibility = !m_visibilityBuffer.empty();
+
+  if (depth) {
+    parallelForTiles(size, [&](int x, int y) {
+      const auto idx = size_t(y) * size.x + x;
+      Ray ray = m_camera->createRay(screenFromPixel(float2(x, y)));
+      const float d = m_renderer->renderDepth(ray, *m_world);
+      m_depthBuffer[idx] = d;
+      if (visibility)
+        m_visibilityBuffer[idx] = isVisible(d) ? 255 : 0;
+    });
+  } else if (visibility) {
+    // Only hit or miss is needed: trace packets of occlusion rays per row
+    constexpr uint32_t N = Renderer::VISIBILITY_PACKET_SIZE;
+    parallelForTileRows(
+        size,
+        [&](int x0, int x1, int y) {
+          for (int x = x0; x < x1; x += N) {
+            const uint32_t count = std::min(uint32_t(x1 - x), N);
+            Ray rays[N];
+            bool visible[N];
+            for (uint32_t i = 0; i < count; i++) {
+              rays[i] =
+                  m_camera->createRay(screenFromPixel(float2(x + i, y)));
+            }
+            m_renderer->renderVisibility(rays, count, *m_world, visible);
+            const auto idx = size_t(y) * size.x + x;
+            for (uint32_t i = 0; i < count; i++)
+              m_visibilityBuffer[idx + i] = visible[i] ? 255 : 0;
+          }
+        },
+        []() { return false; });
+  }
+}
+
+void Frame::fillBlocks(int blockSize)
+{
+  const auto &size = m_frameData.size;
+  embree::parallel_for(size.y, [&](int y) {
+    const int srcY = y - y % blockSize;
+    for (int x = 0; x < int(size.x); x++) {
+      const int srcX = x - x % blockSize;
+      if (srcX != x || srcY != y)
+        copyPixel(size_t(y) * size.x + x, size_t(srcY) * size.x + srcX);
+    }
+  });
+}
+
+void Frame::copyPixel(size_t dst, size_t src)
+{
+  auto copy = [&](auto &buffer, size_t elementsPerPixel) {
+    if (buffer.empty())
+      return;
+    std::copy_n(buffer.data() + src * elementsPerPixel,
+        elementsPerPixel,
+        buffer.data() + dst * elementsPerPixel);
+  };
+
+  copy(m_pixelBuffer, m_perPixelBytes);
+  copy(m_depthBuffer, 1);
+  if (m_normalType != ANARI_UNKNOWN)
+    copy(m_normalBuffer, anari::sizeOf(m_normalType));
+  if (m_albedoType != ANARI_UNKNOWN)
+    copy(m_albedoBuffer, anari::sizeOf(m_albedoType));
+  copy(m_primitiveIdBuffer, 1);
+  copy(m_objectIdBuffer, 1);
+  copy(m_instanceIdBuffer, 1);
+  copy(m_visibilityBuffer, 1);
+}
+
+uint32_t Frame::sampleSeed(size_t pixel) const
+{
+  return uint32_t(pixel) * 0x9e3779b1u + m_accumFrames;
+}
+
 void Frame::writeSample(int x, int y, const PixelSample &s)
 {
   const auto idx = y * m_frameData.size.x + x;
+
+  auto color = s.color;
+  if (m_accumulate) {
+    auto &sum = m_accumBuffer[idx];
+    sum = m_accumFrames == 0 ? s.color : sum + s.color;
+    color = sum / float(m_accumFrames + 1);
+  }
+
+  if (m_denoise)
+    m_denoiser.setSample(idx, color, s); // color is written after filtering
+  if (!m_denoise || m_progressive)
+    writeColor(idx, color);
+  if (!m_depthBuffer.empty())
+    m_depthBuffer[idx] = s.depth;
+  if (m_auxChannels != AUX_NONE)
+    writeAuxSample(idx, s);
+  if (!m_visibilityBuffer.empty())
+    m_visibilityBuffer[idx] = isVisible(s.depth) ? 255 : 0;
+}
+
+void Frame::writeColor(size_t idx, const float4 &c)
+{
   auto *color = m_pixelBuffer.data() + (idx * m_perPixelBytes);
   switch (m_colorType) {
   case ANARI_UFIXED8_VEC4: {
-    auto c = cvt_uint32(s.color);
-    std::memcpy(color, &c, sizeof(c));
+    auto v = cvt_uint32(c);
+    std::memcpy(color, &v, sizeof(v));
     break;
   }
   case ANARI_UFIXED8_RGBA_SRGB: {
-    auto c = cvt_uint32_srgb(s.color);
-    std::memcpy(color, &c, sizeof(c));
+    auto v = cvt_uint32_srgb(c);
+    std::memcpy(color, &v, sizeof(v));
     break;
   }
   case ANARI_FLOAT32_VEC4: {
-    std::memcpy(color, &s.color, sizeof(s.color));
+    std::memcpy(color, &c, sizeof(c));
     break;
   }
   default:
     break;
   }
-  if (!m_depthBuffer.empty())
-    m_depthBuffer[idx] = s.depth;
+}
+
+void Frame::writeAuxSample(size_t idx, const PixelSample &s)
+{
+  if (m_auxChannels & AUX_NORMAL) {
+    if (m_normalType == ANARI_FLOAT32_VEC3)
+      std::memcpy(m_normalBuffer.data() + idx * sizeof(float3),
+          &s.normal,
+          sizeof(float3));
+    else {
+      auto *n = (int16_t *)m_normalBuffer.data() + 3 * idx;
+      n[0] = cvt_int16(s.normal.x);
+      n[1] = cvt_int16(s.normal.y);
+      n[2] = cvt_int16(s.normal.z);
+    }
+  }
+
+  if (m_auxChannels & AUX_ALBEDO) {
+    if (m_albedoType == ANARI_FLOAT32_VEC3)
+      std::memcpy(m_albedoBuffer.data() + idx * sizeof(float3),
+          &s.albedo,
+          sizeof(float3));
+    else {
+      const auto c = m_albedoType == ANARI_UFIXED8_RGB_SRGB
+          ? cvt_uint32_srgb(float4(s.albedo, 1.f))
+          : cvt_uint32(float4(s.albedo, 1.f));
+      std::memcpy(m_albedoBuffer.data() + 3 * idx, &c, 3);
+    }
+  }
+
+  if (m_auxChannels & AUX_PRIMITIVE_ID)
+    m_primitiveIdBuffer[idx] = s.primitiveId;
+  if (m_auxChannels & AUX_OBJECT_ID)
+    m_objectIdBuffer[idx] = s.objectId;
+  if (m_auxChannels & AUX_INSTANCE_ID)
+    m_instanceIdBuffer[idx] = s.instanceId;
 }
 
 } // namespace helide
@@ -3,13 +3,19 @@
 
 #pragma once
 
+#include "Denoiser.h"
 #include "camera/Camera.h"
 #include "renderer/Renderer.h"
 #include "scene/World.h"
 // helium
 #include "helium/BaseFrame.h"
 // std
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <future>
+#include <limits>
+#include <mutex>
 #include <vector>
 
 namespace helide {
@@ -42,13 +48,41 @@ struct Frame : public helium::BaseFrame
 
   void *mapColorBuffer();
   void *mapDepthBuffer();
+  void *mapAuxBuffer(std::string_view channel, ANARIDataType *pixelType);
 
   bool ready() const;
   void wait() const;
 
  private:
+  struct PickResult
+  {
+    uint32_t instanceId{~0u};
+    uint32_t objectId{~0u};
+    uint32_t primitiveId{~0u};
+    float3 position{0.f};
+    float depth{std::numeric_limits<float>::infinity()};
+  };
+
+  bool getPickProperty(const std::string_view &name,
+      ANARIDataType type,
+      void *ptr,
+      uint32_t flags);
+  PickResult pick(const float2 &screen) const;
+
   float2 screenFromPixel(const float2 &p) const;
+  void updateRenderScale();
+  uint2 renderSize() const;
+  void upscaleSamples(const uint2 &renderSize);
+  void renderDepthVisibility();
+  bool renderProgressive(
+      std::chrono::steady_clock::time_point start, uint32_t sampleChannels);
+  void fillBlocks(int blockSize);
+  void copyPixel(size_t dst, size_t src);
+  void waitForFirstPass() const;
+  uint32_t sampleSeed(size_t pixel) const;
   void writeSample(int x, int y, const PixelSample &s);
+  void writeColor(size_t idx, const float4 &c);
+  void writeAuxSample(size_t idx, const PixelSample &s);
 
   //// Data ////
 
@@ -68,6 +102,52 @@ struct Frame : public helium::BaseFrame
   std::vector<uint8_t> m_pixelBuffer;
   std::vector<float> m_depthBuffer;
 
+  // Auxiliary channels, one buffer per channel which is only allocated (and
+  // rendered) if requested through its 'channel.*' parameter
+  uint32_t m_auxChannels{AUX_NONE};
+  anari::DataType m_normalType{ANARI_UNKNOWN};
+  anari::DataType m_albedoType{ANARI_UNKNOWN};
+  std::vector<uint8_t> m_normalBuffer;
+  std::vector<uint8_t> m_albedoBuffer;
+  std::vector<uint32_t> m_primitiveIdBuffer;
+  std::vector<uint32_t> m_objectIdBuffer;
+  std::vector<uint32_t> m_instanceIdBuffer;
+
+  // 'channel.visibility': 255 where a ray hits anything, 0 otherwise
+  std::vector<uint8_t> m_visibilityBuffer;
+
+  // Neither color nor auxiliary channels are requested, only depth and/or
+  // visibility: frames take the fast paths which do no shading
+  bool m_depthVisibilityOnly{false};
+
+  // Stochastic renderers: colors are averaged over 'm_accumFrames' frames
+  // rendered since the scene last changed
+  bool m_accumulate{false};
+  uint32_t m_accumFrames{0};
+  std::vector<float4> m_accumBuffer;
+
+  bool m_denoise{false};
+  Denoiser m_denoiser;
+
+  // Dynamic resolution: while the scene keeps changing, frames are rendered
+  // at 'm_renderScale' times 'size' into 'm_scaledSamples' and upscaled
+  float m_targetFrameTime{0.f};
+  float m_dynamicScale{1.f};
+  float m_renderScale{1.f};
+  std::vector<PixelSample> m_scaledSamples;
+
+  // Progressive refinement: rays are traced on a grid of 8x8, 4x4, 2x2 and
+  // finally 1x1 pixel blocks, with the buffers filled after each pass so they
+  // can be mapped before the frame is finished
+  bool m_progressive{false};
+  bool m_renderingProgressively{false}; // if the current render is progressive
+  float m_timeBudget{0.f};
+  std::atomic<bool> m_discarded{false};
+  bool m_frameComplete{true};
+  uint32_t m_blockSize{1}; // of the last finished pass, 0 before the first
+  mutable std::mutex m_passMutex;
+  mutable std::condition_variable m_passFinished;
+
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
   helium::IntrusivePtr<World> m_world;
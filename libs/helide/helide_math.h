@@ -7,8 +7,11 @@
 #include <anari/anari_cpp/ext/linalg.h>
 #include <anari/anari_cpp.hpp>
 // std
+#include <array>
+#include <cmath>
 #include <cstring>
 #include <limits>
+#include <type_traits>
 // embree
 #include <embree3/rtcore_common.h>
 
@@ -90,6 +93,14 @@ struct Ray
   unsigned int primID{RTC_INVALID_GEOMETRY_ID}; // primitive ID
   unsigned int geomID{RTC_INVALID_GEOMETRY_ID}; // geometry ID
   unsigned int instID{RTC_INVALID_GEOMETRY_ID}; // instance ID
+
+  // Ray cone (texture footprint) //
+
+  float coneWidth{0.f}; // footprint width at 'org'
+  float coneSpread{0.f}; // footprint width growth per unit distance
+
+  // Seed for stochastic renderers, unique per pixel and accumulated frame
+  uint32_t seed{0};
 };
 
 struct Volume;
@@ -144,6 +155,72 @@ inline float toneMap(float v)
     return v;
 }
 
+// toneMap() of every 8-bit normalized value, so decoding 8-bit sRGB data is a
+// table lookup instead of a pow() per channel
+inline const std::array<float, 256> SRGB8_TABLE = []() {
+  std::array<float, 256> table;
+  for (int i = 0; i < 256; i++)
+    table[i] = toneMap<true>(i / 255.f);
+  return table;
+}();
+
+template <bool SRGB = true>
+inline float inverseToneMap(float v)
+{
+  if constexpr (SRGB)
+    return std::pow(v, 2.2f);
+  else
+    return v;
+}
+
+inline float halfToFloat(uint16_t h)
+{
+  const uint32_t sign = uint32_t(h & 0x8000) << 16;
+  uint32_t exponent = (h >> 10) & 0x1f;
+  uint32_t mantissa = h & 0x3ff;
+
+  uint32_t bits = 0;
+  if (exponent == 0x1f) // inf/nan
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  else if (exponent != 0) // normalized
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  else if (mantissa != 0) { // denormalized
+    exponent = 113;
+    while ((mantissa & 0x400) == 0) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+  } else // signed zero
+    bits = sign;
+
+  float retval;
+  std::memcpy(&retval, &bits, sizeof(retval));
+  return retval;
+}
+
+inline uint16_t floatToHalf(float f)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  const uint16_t sign = (bits >> 16) & 0x8000;
+  const uint32_t absBits = bits & 0x7fffffff;
+
+  if (absBits > 0x7f800000) // nan
+    return sign | 0x7e00;
+  if (absBits >= 0x47800000) // inf/overflow
+    return sign | 0x7c00;
+  if (absBits < 0x38800000) // denormalized or zero, in units of 2^-24
+    return sign | uint16_t(std::nearbyint(std::abs(f) * 16777216.f));
+
+  // normalized, rebias exponent and round mantissa to nearest even
+  uint32_t h = (absBits - 0x38000000) >> 13;
+  const uint32_t rest = absBits & 0x1fff;
+  if (rest > 0x1000 || (rest == 0x1000 && (h & 1)))
+    h++;
+  return sign | uint16_t(h);
+}
+
 struct Interpolant
 {
   int32_t lower;
@@ -231,24 +308,33 @@ static const T *typedOffset(const void *mem, uint64_t offset)
   return ((const T *)mem) + offset;
 }
 
+template <typename ELEMENT_T, bool SRGB = false>
+inline float ufixedToFloat(ELEMENT_T v)
+{
+  constexpr float m = std::numeric_limits<ELEMENT_T>::max();
+  if constexpr (SRGB && std::is_same_v<ELEMENT_T, uint8_t>)
+    return SRGB8_TABLE[v];
+  else
+    return toneMap<SRGB>(v / m);
+}
+
 template <typename ELEMENT_T, int NUM_COMPONENTS, bool SRGB = false>
 static float4 getAttributeArrayAt_ufixed(void *data, uint64_t offset)
 {
-  constexpr float m = std::numeric_limits<ELEMENT_T>::max();
   float4 retval(0.f, 0.f, 0.f, 1.f);
   switch (NUM_COMPONENTS) {
   case 4:
-    retval.w = toneMap<SRGB>(
-        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 3) / m);
+    retval.w = ufixedToFloat<ELEMENT_T, SRGB>(
+        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 3));
   case 3:
-    retval.z = toneMap<SRGB>(
-        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 2) / m);
+    retval.z = ufixedToFloat<ELEMENT_T, SRGB>(
+        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 2));
   case 2:
-    retval.y = toneMap<SRGB>(
-        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 1) / m);
+    retval.y = ufixedToFloat<ELEMENT_T, SRGB>(
+        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 1));
   case 1:
-    retval.x = toneMap<SRGB>(
-        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 0) / m);
+    retval.x = ufixedToFloat<ELEMENT_T, SRGB>(
+        *typedOffset<ELEMENT_T>(data, NUM_COMPONENTS * offset + 0));
   default:
     break;
   }
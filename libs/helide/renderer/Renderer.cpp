@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Renderer.h"
+// std
+#include <algorithm>
+#include <cmath>
 
 namespace helide {
 
@@ -9,36 +12,28 @@ namespace helide {
 
 static RenderMode renderModeFromString(const std::string &name)
 {
-  if (name == "primID")
-    return RenderMode::PRIM_ID;
-  else if (name == "geomID")
-    return RenderMode::GEOM_ID;
-  else if (name == "instID")
-    return RenderMode::INST_ID;
-  else if (name == "Ng")
-    return RenderMode::NG;
-  else if (name == "Ng.abs")
-    return RenderMode::NG_ABS;
-  else if (name == "uvw")
-    return RenderMode::RAY_UVW;
-  else if (name == "hitSurface")
-    return RenderMode::HIT_SURFACE;
-  else if (name == "hitVolume")
-    return RenderMode::HIT_VOLUME;
-  else if (name == "backface")
-    return RenderMode::BACKFACE;
-  else if (name == "geometry.attribute0")
-    return RenderMode::GEOMETRY_ATTRIBUTE_0;
-  else if (name == "geometry.attribute1")
-    return RenderMode::GEOMETRY_ATTRIBUTE_1;
-  else if (name == "geometry.attribute2")
-    return RenderMode::GEOMETRY_ATTRIBUTE_2;
-  else if (name == "geometry.attribute3")
-    return RenderMode::GEOMETRY_ATTRIBUTE_3;
-  else if (name == "geometry.color")
-    return RenderMode::GEOMETRY_ATTRIBUTE_COLOR;
-  else
-    return RenderMode::DEFAULT;
+  static const std::pair<std::string_view, RenderMode> modes[] = {
+      {"primID", RenderMode::PRIM_ID},
+      {"geomID", RenderMode::GEOM_ID},
+      {"instID", RenderMode::INST_ID},
+      {"Ng", RenderMode::NG},
+      {"Ng.abs", RenderMode::NG_ABS},
+      {"uvw", RenderMode::RAY_UVW},
+      {"hitSurface", RenderMode::HIT_SURFACE},
+      {"hitVolume", RenderMode::HIT_VOLUME},
+      {"backface", RenderMode::BACKFACE},
+      {"geometry.attribute0", RenderMode::GEOMETRY_ATTRIBUTE_0},
+      {"geometry.attribute1", RenderMode::GEOMETRY_ATTRIBUTE_1},
+      {"geometry.attribute2", RenderMode::GEOMETRY_ATTRIBUTE_2},
+      {"geometry.attribute3", RenderMode::GEOMETRY_ATTRIBUTE_3},
+      {"geometry.color", RenderMode::GEOMETRY_ATTRIBUTE_COLOR}};
+
+  for (const auto &m : modes) {
+    if (m.first == name)
+      return m.second;
+  }
+
+  return RenderMode::DEFAULT;
 }
 
 static float3 makeRandomColor(uint32_t i)
@@ -59,16 +54,81 @@ static float3 boolColor(bool pred)
 
 static float3 readAttributeValue(Attribute a, const Ray &r, const World &w)
 {
-  const Instance *inst = w.instances()[r.instID];
-  const Surface *surface = inst->group()->surfaces()[r.geomID];
-  const Geometry *geom = surface->geometry();
-  const auto v = geom->getAttributeValue(a, r);
+  const auto &hr = w.hitRecords();
+  const auto v = hr.getAttributeValue(hr.index(r.instID, r.geomID), a, r);
   return float3(v.x, v.y, v.z);
 }
 
+static uint32_t hashUint32(uint32_t x)
+{
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+// Uniform random number in [0, 1)
+static float randomFloat(uint32_t &state)
+{
+  state = hashUint32(state + 0x9e3779b9u);
+  return (state >> 8) * (1.f / 16777216.f);
+}
+
+static float3 cosineSampleHemisphere(const float3 &n, float u1, float u2)
+{
+  // Orthonormal basis from Duff et al., JCGT 2017
+  const float sign = std::copysign(1.f, n.z);
+  const float a = -1.f / (sign + n.z);
+  const float b = n.x * n.y * a;
+  const float3 t(1.f + sign * n.x * n.x * a, sign * b, -sign * n.x);
+  const float3 bt(b, sign + n.y * n.y * a, -n.y);
+
+  const float r = std::sqrt(u1);
+  const float phi = 2.f * float(M_PI) * u2;
+  return r * std::cos(phi) * t + r * std::sin(phi) * bt
+      + std::sqrt(std::max(0.f, 1.f - u1)) * n;
+}
+
+// Set 'occluded[i]' for each of up to 8 rays which hits anything
+static void traceOcclusionPacket(
+    RTCScene scene, const Ray *rays, uint32_t count, bool *occluded)
+{
+  constexpr uint32_t N = Renderer::VISIBILITY_PACKET_SIZE;
+
+  alignas(32) int valid[N];
+  RTCRay8 packet;
+  for (uint32_t i = 0; i < N; i++) {
+    valid[i] = i < count ? -1 : 0;
+    const Ray &r = rays[std::min(i, count - 1)];
+    packet.org_x[i] = r.org.x;
+    packet.org_y[i] = r.org.y;
+    packet.org_z[i] = r.org.z;
+    packet.tnear[i] = r.tnear;
+    packet.dir_x[i] = r.dir.x;
+    packet.dir_y[i] = r.dir.y;
+    packet.dir_z[i] = r.dir.z;
+    packet.time[i] = r.time;
+    packet.tfar[i] = r.tfar;
+    packet.mask[i] = r.mask;
+    packet.id[i] = r.id;
+    packet.flags[i] = r.flags;
+  }
+
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+  rtcOccluded8(valid, scene, &context, &packet);
+
+  // Occluded rays get a negative 'tfar'
+  for (uint32_t i = 0; i < count; i++)
+    occluded[i] = packet.tfar[i] < 0.f;
+}
+
 // Renderer definitions ///////////////////////////////////////////////////////
 
-Renderer::Renderer(HelideGlobalState *s) : Object(ANARI_RENDERER, s)
+Renderer::Renderer(HelideGlobalState *s, bool ambientOcclusion)
+    : Object(ANARI_RENDERER, s), m_ambientOcclusion(ambientOcclusion)
 {
   s->objectCounts.renderers++;
 }
@@ -82,136 +142,324 @@ void Renderer::commit()
 {
   m_bgColor = getParam<float4>("background", float4(float3(0.f), 1.f));
   m_ambientRadiance = getParam<float>("ambientRadiance", 1.f);
-  m_mode = renderModeFromString(getParamString("mode", "default"));
+  m_mode = m_ambientOcclusion
+      ? RenderMode::AMBIENT_OCCLUSION
+      : renderModeFromString(getParamString("mode", "default"));
+  m_kernels = sampleKernelsFor(m_mode);
+
+  m_aoSamples = getParam<uint32_t>("aoSamples", 1);
+  m_aoDistance = getParam<float>("aoDistance", 1e20f);
 }
 
-PixelSample Renderer::renderSample(Ray ray, const World &w) const
+bool Renderer::isStochastic() const
 {
-  // Intersect Surfaces //
+  return m_mode == RenderMode::AMBIENT_OCCLUSION && m_aoSamples > 0;
+}
 
-  RTCIntersectContext context;
-  rtcInitIntersectContext(&context);
-  rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&ray);
-  const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
+PixelSample Renderer::renderSample(
+    Ray ray, const World &w, uint32_t auxChannels) const
+{
+  const int contents = int(w.hasSurfaces()) | (int(w.hasVolumes()) << 1);
+  return (this->*m_kernels[contents])(ray, w, auxChannels);
+}
 
-  // Intersect Volumes //
+float Renderer::renderDepth(Ray ray, const World &w) const
+{
+  if (w.hasSurfaces()) {
+    RTCIntersectContext context;
+    rtcInitIntersectContext(&context);
+    rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&ray);
+  }
 
-  VolumeRay vray;
-  vray.org = ray.org;
-  vray.dir = ray.dir;
-  vray.t.upper = ray.tfar;
-  w.intersectVolumes(vray);
-  const bool hitVolume = vray.volume != nullptr;
+  if (w.hasVolumes() && volumesVisible()) {
+    VolumeRay vray;
+    vray.org = ray.org;
+    vray.dir = ray.dir;
+    vray.t.upper = ray.tfar;
+    w.intersectVolumes(vray);
+    if (vray.volume)
+      return std::min(ray.tfar, vray.t.lower);
+  }
 
-  // Shade //
+  return ray.tfar;
+}
 
-  const float3 color = shadeRay(ray, vray, w);
-  const float depth = hitVolume ? std::min(ray.tfar, vray.t.lower) : ray.tfar;
-  return {float4(color, 1.f), depth};
+void Renderer::renderVisibility(
+    const Ray *rays, uint32_t count, const World &w, bool *visible) const
+{
+  std::fill(visible, visible + count, false);
+
+  if (w.hasSurfaces())
+    traceOcclusionPacket(w.embreeScene(), rays, count, visible);
+
+  if (w.hasVolumes() && volumesVisible()) {
+    for (uint32_t i = 0; i < count; i++) {
+      if (visible[i])
+        continue;
+      VolumeRay vray;
+      vray.org = rays[i].org;
+      vray.dir = rays[i].dir;
+      w.intersectVolumes(vray);
+      visible[i] = vray.volume != nullptr;
+    }
+  }
 }
 
 Renderer *Renderer::createInstance(
-    std::string_view /* subtype */, HelideGlobalState *s)
+    std::string_view subtype, HelideGlobalState *s)
 {
-  return new Renderer(s);
+  return new Renderer(s, subtype == "ao");
 }
 
-float3 Renderer::shadeRay(
-    const Ray &ray, const VolumeRay &vray, const World &w) const
+template <RenderMode MODE, bool SURFACES, bool VOLUMES>
+PixelSample Renderer::renderSampleKernel(
+    Ray ray, const World &w, uint32_t auxChannels) const
 {
-  const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
-  const bool hitVolume = vray.volume != nullptr;
+  // Only the default, 'ao' and 'hitVolume' modes show volumes
+  constexpr bool useVolumes = VOLUMES
+      && (MODE == RenderMode::DEFAULT || MODE == RenderMode::AMBIENT_OCCLUSION
+          || MODE == RenderMode::HIT_VOLUME);
 
-  if (!hitGeometry && !hitVolume)
-    return float3(m_bgColor.x, m_bgColor.y, m_bgColor.z);
+  // Intersect Surfaces //
 
-  const float3 bgColor(m_bgColor.x, m_bgColor.y, m_bgColor.z);
+  if constexpr (SURFACES) {
+    RTCIntersectContext context;
+    rtcInitIntersectContext(&context);
+    rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&ray);
+  }
+  const bool hitGeometry = SURFACES && ray.geomID != RTC_INVALID_GEOMETRY_ID;
 
-  float3 color(0.f, 0.f, 0.f);
-  float opacity = 0.f;
+  // Intersect Volumes //
+
+  VolumeRay vray;
+  if constexpr (useVolumes) {
+    vray.org = ray.org;
+    vray.dir = ray.dir;
+    vray.t.upper = ray.tfar;
+    w.intersectVolumes(vray);
+  }
+  const bool hitVolume = useVolumes && vray.volume != nullptr;
+
+  // Shade //
+
+  const float depth = hitVolume ? std::min(ray.tfar, vray.t.lower) : ray.tfar;
+
+  PixelSample sample;
+  sample.depth = depth;
+
+  if (!hitGeometry && !hitVolume) {
+    sample.color = float4(m_bgColor.x, m_bgColor.y, m_bgColor.z, 1.f);
+    return sample;
+  }
+
+  const float3 color = shadeRay<MODE>(ray, vray, w, hitGeometry, hitVolume);
+  sample.color = float4(color, 1.f);
+
+  if (hitGeometry && auxChannels != AUX_NONE)
+    writeAuxChannels(sample, ray, w, auxChannels);
+
+  return sample;
+}
 
-  float3 geometryColor(0.f, 0.f, 0.f);
-  float geometryOpacity = hitGeometry ? 1.f : 0.f;
+template <RenderMode MODE>
+Renderer::SampleKernels Renderer::sampleKernels()
+{
+  return {&Renderer::renderSampleKernel<MODE, false, false>,
+      &Renderer::renderSampleKernel<MODE, true, false>,
+      &Renderer::renderSampleKernel<MODE, false, true>,
+      &Renderer::renderSampleKernel<MODE, true, true>};
+}
 
-  switch (m_mode) {
+Renderer::SampleKernels Renderer::sampleKernelsFor(RenderMode mode)
+{
+  switch (mode) {
   case RenderMode::PRIM_ID:
-    color = hitGeometry ? makeRandomColor(ray.primID) : bgColor;
-    break;
+    return sampleKernels<RenderMode::PRIM_ID>();
   case RenderMode::GEOM_ID:
-    color = hitGeometry ? makeRandomColor(ray.geomID) : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOM_ID>();
   case RenderMode::INST_ID:
-    color = hitGeometry ? makeRandomColor(ray.instID) : bgColor;
-    break;
+    return sampleKernels<RenderMode::INST_ID>();
+  case RenderMode::NG:
+    return sampleKernels<RenderMode::NG>();
+  case RenderMode::NG_ABS:
+    return sampleKernels<RenderMode::NG_ABS>();
   case RenderMode::RAY_UVW:
-    color = hitGeometry ? float3(ray.u, ray.v, 1.f) : bgColor;
-    break;
+    return sampleKernels<RenderMode::RAY_UVW>();
   case RenderMode::HIT_SURFACE:
-    color = hitGeometry ? boolColor(hitGeometry) : bgColor;
-    break;
+    return sampleKernels<RenderMode::HIT_SURFACE>();
   case RenderMode::HIT_VOLUME:
-    color = hitVolume ? boolColor(hitVolume) : bgColor;
-    geometryOpacity = 1.f;
-    break;
+    return sampleKernels<RenderMode::HIT_VOLUME>();
   case RenderMode::BACKFACE:
-    color =
-        hitGeometry ? boolColor(linalg::dot(ray.Ng, ray.dir) < 0.f) : bgColor;
-    break;
-  case RenderMode::NG:
-    color = hitGeometry ? ray.Ng : bgColor;
-    break;
-  case RenderMode::NG_ABS:
-    color = hitGeometry ? linalg::abs(ray.Ng) : bgColor;
-    break;
+    return sampleKernels<RenderMode::BACKFACE>();
   case RenderMode::GEOMETRY_ATTRIBUTE_0:
-    color = hitGeometry ? readAttributeValue(Attribute::ATTRIBUTE_0, ray, w)
-                        : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOMETRY_ATTRIBUTE_0>();
   case RenderMode::GEOMETRY_ATTRIBUTE_1:
-    color = hitGeometry ? readAttributeValue(Attribute::ATTRIBUTE_1, ray, w)
-                        : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOMETRY_ATTRIBUTE_1>();
   case RenderMode::GEOMETRY_ATTRIBUTE_2:
-    color = hitGeometry ? readAttributeValue(Attribute::ATTRIBUTE_2, ray, w)
-                        : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOMETRY_ATTRIBUTE_2>();
   case RenderMode::GEOMETRY_ATTRIBUTE_3:
-    color = hitGeometry ? readAttributeValue(Attribute::ATTRIBUTE_3, ray, w)
-                        : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOMETRY_ATTRIBUTE_3>();
   case RenderMode::GEOMETRY_ATTRIBUTE_COLOR:
-    color =
-        hitGeometry ? readAttributeValue(Attribute::COLOR, ray, w) : bgColor;
-    break;
+    return sampleKernels<RenderMode::GEOMETRY_ATTRIBUTE_COLOR>();
+  case RenderMode::AMBIENT_OCCLUSION:
+    return sampleKernels<RenderMode::AMBIENT_OCCLUSION>();
   case RenderMode::DEFAULT:
-  default: {
+  default:
+    return sampleKernels<RenderMode::DEFAULT>();
+  }
+}
+
+template <RenderMode MODE>
+float3 Renderer::shadeRay(const Ray &ray,
+    const VolumeRay &vray,
+    const World &w,
+    bool hitGeometry,
+    bool hitVolume) const
+{
+  const float3 bgColor(m_bgColor.x, m_bgColor.y, m_bgColor.z);
+
+  // Debug modes //
+
+  if constexpr (MODE == RenderMode::HIT_VOLUME)
+    return linalg::min(hitVolume ? boolColor(hitVolume) : bgColor, float3(1.f));
+  else if constexpr (MODE != RenderMode::DEFAULT
+      && MODE != RenderMode::AMBIENT_OCCLUSION) {
+    if (!hitGeometry)
+      return bgColor;
+
+    float3 color;
+    if constexpr (MODE == RenderMode::PRIM_ID)
+      color = makeRandomColor(ray.primID);
+    else if constexpr (MODE == RenderMode::GEOM_ID)
+      color = makeRandomColor(ray.geomID);
+    else if constexpr (MODE == RenderMode::INST_ID)
+      color = makeRandomColor(ray.instID);
+    else if constexpr (MODE == RenderMode::RAY_UVW)
+      color = float3(ray.u, ray.v, 1.f);
+    else if constexpr (MODE == RenderMode::HIT_SURFACE)
+      color = boolColor(hitGeometry);
+    else if constexpr (MODE == RenderMode::BACKFACE)
+      color = boolColor(linalg::dot(ray.Ng, ray.dir) < 0.f);
+    else if constexpr (MODE == RenderMode::NG)
+      color = ray.Ng;
+    else if constexpr (MODE == RenderMode::NG_ABS)
+      color = linalg::abs(ray.Ng);
+    else if constexpr (MODE == RenderMode::GEOMETRY_ATTRIBUTE_0)
+      color = readAttributeValue(Attribute::ATTRIBUTE_0, ray, w);
+    else if constexpr (MODE == RenderMode::GEOMETRY_ATTRIBUTE_1)
+      color = readAttributeValue(Attribute::ATTRIBUTE_1, ray, w);
+    else if constexpr (MODE == RenderMode::GEOMETRY_ATTRIBUTE_2)
+      color = readAttributeValue(Attribute::ATTRIBUTE_2, ray, w);
+    else if constexpr (MODE == RenderMode::GEOMETRY_ATTRIBUTE_3)
+      color = readAttributeValue(Attribute::ATTRIBUTE_3, ray, w);
+    else if constexpr (MODE == RenderMode::GEOMETRY_ATTRIBUTE_COLOR)
+      color = readAttributeValue(Attribute::COLOR, ray, w);
+    else
+      color = bgColor;
+
+    return linalg::min(color, float3(1.f));
+  } else {
+    // Default and 'ao' modes //
+
+    float3 color(0.f, 0.f, 0.f);
+    float opacity = 0.f;
+
+    float3 geometryColor(0.f, 0.f, 0.f);
+    float geometryOpacity = hitGeometry ? 1.f : 0.f;
+
     if (hitGeometry) {
-      const Instance *inst = w.instances()[ray.instID];
-      const Surface *surface = inst->group()->surfaces()[ray.geomID];
-
-      const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
-      const auto falloff =
-          std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
-      const float3 c = surface->getSurfaceColor(ray);
-      const float3 sc = c * falloff;
-      geometryColor =
-          linalg::min((0.8f * sc + 0.2f * c) * m_ambientRadiance, float3(1.f));
+      const auto &hr = w.hitRecords();
+      const uint32_t i = hr.index(ray.instID, ray.geomID);
+
+      const auto n = linalg::mul(hr.xfmInvRot(ray.instID), ray.Ng);
+      const float3 c = hr.getSurfaceColor(i, ray);
+      if constexpr (MODE == RenderMode::AMBIENT_OCCLUSION) {
+        auto nn = linalg::normalize(n);
+        if (linalg::dot(nn, ray.dir) > 0.f)
+          nn = -nn;
+        const float3 p = ray.org + ray.tfar * ray.dir;
+        const float ao = ambientOcclusion(p, nn, ray.seed, w);
+        geometryColor = linalg::min(c * ao * m_ambientRadiance, float3(1.f));
+      } else {
+        const auto falloff =
+            std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
+        const float3 sc = c * falloff;
+        geometryColor = linalg::min(
+            (0.8f * sc + 0.2f * c) * m_ambientRadiance, float3(1.f));
+      }
     }
 
     if (hitVolume)
       vray.volume->render(vray, color, opacity);
 
-  } break;
+    color = linalg::min(color, float3(1.f));
+
+    accumulateValue(color, geometryColor, opacity);
+    accumulateValue(opacity, geometryOpacity, opacity);
+    color *= opacity;
+    accumulateValue(color, bgColor, opacity);
+
+    return color;
   }
+}
+
+bool Renderer::volumesVisible() const
+{
+  return m_mode == RenderMode::DEFAULT
+      || m_mode == RenderMode::AMBIENT_OCCLUSION
+      || m_mode == RenderMode::HIT_VOLUME;
+}
 
-  color = linalg::min(color, float3(1.f));
+float Renderer::ambientOcclusion(
+    const float3 &p, const float3 &n, uint32_t seed, const World &w) const
+{
+  if (m_aoSamples == 0)
+    return 1.f;
+
+  // Hemisphere rays share their origin, trace them in packets
+  constexpr uint32_t N = VISIBILITY_PACKET_SIZE;
+  const float eps = 1e-4f * std::max(1.f, linalg::maxelem(linalg::abs(p)));
+  const float3 org = p + eps * n;
+
+  uint32_t rng = hashUint32(seed);
+  uint32_t unoccluded = 0;
+  for (uint32_t s = 0; s < m_aoSamples; s += N) {
+    const uint32_t count = std::min(m_aoSamples - s, N);
+    Ray rays[N];
+    bool occluded[N];
+    for (uint32_t i = 0; i < count; i++) {
+      const float u1 = randomFloat(rng);
+      const float u2 = randomFloat(rng);
+      rays[i].org = org;
+      rays[i].dir = cosineSampleHemisphere(n, u1, u2);
+      rays[i].tfar = m_aoDistance;
+    }
+    traceOcclusionPacket(w.embreeScene(), rays, count, occluded);
+    for (uint32_t i = 0; i < count; i++)
+      unoccluded += occluded[i] ? 0 : 1;
+  }
 
-  accumulateValue(color, geometryColor, opacity);
-  accumulateValue(opacity, geometryOpacity, opacity);
-  color *= opacity;
-  accumulateValue(color, bgColor, opacity);
+  return float(unoccluded) / m_aoSamples;
+}
 
-  return color;
+void Renderer::writeAuxChannels(PixelSample &sample,
+    const Ray &ray,
+    const World &w,
+    uint32_t auxChannels) const
+{
+  const auto &hr = w.hitRecords();
+  const uint32_t i = hr.index(ray.instID, ray.geomID);
+
+  if (auxChannels & AUX_NORMAL)
+    sample.normal = normalize(linalg::mul(hr.xfmInvRot(ray.instID), ray.Ng));
+  if (auxChannels & AUX_ALBEDO)
+    sample.albedo = hr.getSurfaceColor(i, ray);
+  if (auxChannels & AUX_PRIMITIVE_ID)
+    sample.primitiveId = ray.primID;
+  if (auxChannels & AUX_OBJECT_ID)
+    sample.objectId = hr.objectId(i);
+  if (auxChannels & AUX_INSTANCE_ID)
+    sample.instanceId = hr.instanceId(ray.instID);
 }
 
 } // namespace helide
@@ -5,13 +5,34 @@
 
 #include "Object.h"
 #include "scene/World.h"
+// std
+#include <array>
 
 namespace helide {
 
+// Optional frame channels filled in by renderSample(), as bit flags
+enum AuxChannel : uint32_t
+{
+  AUX_NONE = 0,
+  AUX_NORMAL = 1 << 0,
+  AUX_ALBEDO = 1 << 1,
+  AUX_PRIMITIVE_ID = 1 << 2,
+  AUX_OBJECT_ID = 1 << 3,
+  AUX_INSTANCE_ID = 1 << 4
+};
+
 struct PixelSample
 {
   float4 color;
   float depth;
+
+  // Auxiliary channels, only written if requested (first surface hit) //
+
+  float3 normal{0.f};
+  float3 albedo{0.f};
+  uint32_t primitiveId{~0u};
+  uint32_t objectId{~0u};
+  uint32_t instanceId{~0u};
 };
 
 enum class RenderMode
@@ -33,27 +54,72 @@ enum class RenderMode
   GEOMETRY_ATTRIBUTE_1,
   GEOMETRY_ATTRIBUTE_2,
   GEOMETRY_ATTRIBUTE_3,
-  GEOMETRY_ATTRIBUTE_COLOR
+  GEOMETRY_ATTRIBUTE_COLOR,
+  AMBIENT_OCCLUSION
 };
 
 struct Renderer : public Object
 {
-  Renderer(HelideGlobalState *s);
+  Renderer(HelideGlobalState *s, bool ambientOcclusion = false);
   ~Renderer() override;
 
   virtual void commit() override;
 
-  PixelSample renderSample(Ray ray, const World &w) const;
+  // Results differ per Ray::seed and converge when frames are accumulated
+  bool isStochastic() const;
+
+  PixelSample renderSample(
+      Ray ray, const World &w, uint32_t auxChannels = AUX_NONE) const;
+
+  // Fast paths for frames without color or auxiliary channels, which skip
+  // shading and attribute reads. Depth matches renderSample(), visibility is
+  // set if a ray hits anything and is answered with occlusion rays.
+  static constexpr uint32_t VISIBILITY_PACKET_SIZE = 8;
+  float renderDepth(Ray ray, const World &w) const;
+  void renderVisibility(
+      const Ray *rays, uint32_t count, const World &w, bool *visible) const;
 
   static Renderer *createInstance(
       std::string_view subtype, HelideGlobalState *d);
 
  private:
-  float3 shadeRay(const Ray &ray, const VolumeRay &vray, const World &w) const;
+  // Sample kernels are instantiated per render mode and per scene contents
+  // (surfaces, volumes or both), so each only does the work its mode needs
+  using SampleKernel =
+      PixelSample (Renderer::*)(Ray, const World &, uint32_t) const;
+  using SampleKernels = std::array<SampleKernel, 4>; // [surfaces | volumes<<1]
+
+  template <RenderMode MODE, bool SURFACES, bool VOLUMES>
+  PixelSample renderSampleKernel(
+      Ray ray, const World &w, uint32_t auxChannels) const;
+
+  template <RenderMode MODE>
+  static SampleKernels sampleKernels();
+  static SampleKernels sampleKernelsFor(RenderMode mode);
+
+  template <RenderMode MODE>
+  float3 shadeRay(const Ray &ray,
+      const VolumeRay &vray,
+      const World &w,
+      bool hitGeometry,
+      bool hitVolume) const;
+  bool volumesVisible() const;
+  float ambientOcclusion(const float3 &p,
+      const float3 &n,
+      uint32_t seed,
+      const World &w) const;
+  void writeAuxChannels(PixelSample &sample,
+      const Ray &ray,
+      const World &w,
+      uint32_t auxChannels) const;
 
   float4 m_bgColor{float3(0.f), 1.f};
   float m_ambientRadiance{1.f};
   RenderMode m_mode{RenderMode::DEFAULT};
+  bool m_ambientOcclusion{false}; // 'ao' subtype
+  uint32_t m_aoSamples{1};
+  float m_aoDistance{1e20f};
+  SampleKernels m_kernels{sampleKernelsFor(RenderMode::DEFAULT)};
 };
 
 } // namespace helide
@@ -3,6 +3,7 @@
 
 #include "Group.h"
 // std
+#include <algorithm>
 #include <iterator>
 
 namespace helide {
@@ -116,19 +117,16 @@ void Group::embreeSceneConstruct()
 
   reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group rebuilding embree scene");
 
-  rtcReleaseScene(m_embreeScene);
-  m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+  releaseEmbreeScene();
+  m_surfaces.clear();
 
   if (m_surfaceData) {
-    uint32_t id = 0;
     std::for_each(m_surfaceData->handlesBegin(),
         m_surfaceData->handlesEnd(),
         [&](Object *o) {
           auto *s = (Surface *)o;
           if (s && s->isValid()) {
             m_surfaces.push_back(s);
-            rtcAttachGeometryByID(
-                m_embreeScene, s->geometry()->embreeGeometry(), id++);
           } else {
             reportMessage(ANARI_SEVERITY_DEBUG,
                 "helide::Group rejecting invalid surface(%p) in building BLS",
@@ -147,6 +145,35 @@ void Group::embreeSceneConstruct()
         });
   }
 
+  DeduplicationCache::SceneKey key;
+  if (state.deduplicateData) {
+    for (auto *s : m_surfaces) {
+      key.definitions.push_back(s->geometry()->definition());
+      key.hashes.push_back(s->geometry()->definitionHash());
+    }
+    m_embreeScene = deviceState()->dedupCache.acquireScene(key);
+  }
+
+  if (m_embreeScene) {
+    reportMessage(
+        ANARI_SEVERITY_DEBUG, "helide::Group sharing identical embree scene");
+  } else {
+    m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+    // A two-level BVH lets Embree refit geometries updated in place
+    if (std::any_of(m_surfaces.begin(), m_surfaces.end(), [](Surface *s) {
+          return s->geometry()->hasDynamicVertices();
+        })) {
+      rtcSetSceneFlags(m_embreeScene, RTC_SCENE_FLAG_DYNAMIC);
+      rtcSetSceneBuildQuality(m_embreeScene, RTC_BUILD_QUALITY_LOW);
+    }
+    uint32_t id = 0;
+    for (auto *s : m_surfaces)
+      rtcAttachGeometryByID(
+          m_embreeScene, s->geometry()->embreeGeometry(), id++);
+    if (state.deduplicateData)
+      deviceState()->dedupCache.addScene(key, m_embreeScene);
+  }
+
   m_objectUpdates.lastSceneConstruction = helium::newTimeStamp();
   m_objectUpdates.lastSceneCommit = 0;
   embreeSceneCommit();
@@ -166,6 +193,13 @@ void Group::embreeSceneCommit()
   m_objectUpdates.lastSceneCommit = helium::newTimeStamp();
 }
 
+void Group::releaseEmbreeScene()
+{
+  if (m_embreeScene && !deviceState()->dedupCache.releaseScene(m_embreeScene))
+    rtcReleaseScene(m_embreeScene);
+  m_embreeScene = nullptr;
+}
+
 void Group::cleanup()
 {
   if (m_surfaceData)
@@ -179,8 +213,7 @@ void Group::cleanup()
   m_objectUpdates.lastSceneConstruction = 0;
   m_objectUpdates.lastSceneCommit = 0;
 
-  rtcReleaseScene(m_embreeScene);
-  m_embreeScene = nullptr;
+  releaseEmbreeScene();
 }
 
 box3 getEmbreeSceneBounds(RTCScene scene)
@@ -34,6 +34,7 @@ struct Group : public Object
   void embreeSceneCommit();
 
  private:
+  void releaseEmbreeScene();
   void cleanup();
 
   // Geometry //
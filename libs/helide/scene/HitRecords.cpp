@@ -0,0 +1,71 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "HitRecords.h"
+#include "Instance.h"
+
+namespace helide {
+
+void HitRecords::clear()
+{
+  m_instanceOffsets.clear();
+  m_xfmInvRot.clear();
+  m_instanceIds.clear();
+  m_geometries.clear();
+  m_objectIds.clear();
+  m_colors.clear();
+  m_colorAttributes.clear();
+  m_colorSamplers.clear();
+  m_vertexAttributeMasks.clear();
+  for (auto &pa : m_primitiveAttributes)
+    pa.clear();
+}
+
+void HitRecords::build(
+    const std::vector<Instance *> &instances, const float3 &invalidColor)
+{
+  clear();
+
+  // User IDs default to the index in the world/group
+  auto idOrIndex = [](uint32_t id, size_t index) {
+    return id != ~0u ? id : uint32_t(index);
+  };
+
+  for (size_t instID = 0; instID < instances.size(); instID++) {
+    auto *inst = instances[instID];
+    m_instanceOffsets.push_back(uint32_t(m_geometries.size()));
+    m_xfmInvRot.push_back(inst ? inst->xfmInvRot() : mat3(linalg::identity));
+    m_instanceIds.push_back(idOrIndex(inst ? inst->id() : ~0u, instID));
+
+    if (!inst || !inst->isValid())
+      continue;
+
+    const auto &surfaces = inst->group()->surfaces();
+    for (size_t geomID = 0; geomID < surfaces.size(); geomID++) {
+      const auto *s = surfaces[geomID];
+      const auto *geom = s->geometry();
+      const auto *mat = s->material();
+      const auto *sampler = mat ? mat->colorSampler() : nullptr;
+
+      m_geometries.push_back(geom);
+      m_objectIds.push_back(idOrIndex(s->id(), geomID));
+      m_colors.push_back(mat ? mat->color() : invalidColor);
+      m_colorAttributes.push_back(
+          mat ? mat->colorAttribute() : Attribute::NONE);
+      m_colorSamplers.push_back(
+          sampler && sampler->isValid() ? sampler : nullptr);
+
+      uint8_t vertexAttributeMask = 0;
+      for (int a = 0; a < 5; a++) {
+        const auto attr = static_cast<Attribute>(a);
+        if (geom->vertexAttribute(attr))
+          vertexAttributeMask |= 1u << a;
+        m_primitiveAttributes[a].push_back(
+            geom->primitiveAttributeAccessor(attr));
+      }
+      m_vertexAttributeMasks.push_back(vertexAttributeMask);
+    }
+  }
+}
+
+} // namespace helide
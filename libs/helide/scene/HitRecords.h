@@ -0,0 +1,102 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "scene/surface/Surface.h"
+// std
+#include <array>
+#include <vector>
+
+namespace helide {
+
+struct Instance;
+
+// Flattened (SoA) copy of everything needed to shade a surface hit, indexed by
+// (instID, geomID). Built by World together with the TLS so that shading a
+// hit is a single table lookup instead of chasing instance -> group ->
+// surface -> geometry/material pointers.
+struct HitRecords
+{
+  void clear();
+  void build(const std::vector<Instance *> &instances, const float3 &invalid);
+
+  uint32_t index(uint32_t instID, uint32_t geomID) const;
+
+  const mat3 &xfmInvRot(uint32_t instID) const;
+  uint32_t instanceId(uint32_t instID) const;
+  uint32_t objectId(uint32_t i) const;
+
+  float4 getAttributeValue(uint32_t i, Attribute attr, const Ray &ray) const;
+  float3 getSurfaceColor(uint32_t i, const Ray &ray) const;
+
+ private:
+  // Per-instance //
+
+  std::vector<uint32_t> m_instanceOffsets;
+  std::vector<mat3> m_xfmInvRot;
+  std::vector<uint32_t> m_instanceIds;
+
+  // Per-(instance, surface) //
+
+  std::vector<const Geometry *> m_geometries;
+  std::vector<uint32_t> m_objectIds;
+  std::vector<float3> m_colors;
+  std::vector<Attribute> m_colorAttributes;
+  std::vector<const Sampler *> m_colorSamplers;
+  // bit 'i' set: Attribute 'i' is a vertex attribute interpolated by geometry
+  std::vector<uint8_t> m_vertexAttributeMasks;
+  std::array<std::vector<AttributeAccessor>, 5> m_primitiveAttributes;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline uint32_t HitRecords::index(uint32_t instID, uint32_t geomID) const
+{
+  return m_instanceOffsets[instID] + geomID;
+}
+
+inline const mat3 &HitRecords::xfmInvRot(uint32_t instID) const
+{
+  return m_xfmInvRot[instID];
+}
+
+inline uint32_t HitRecords::instanceId(uint32_t instID) const
+{
+  return m_instanceIds[instID];
+}
+
+inline uint32_t HitRecords::objectId(uint32_t i) const
+{
+  return m_objectIds[i];
+}
+
+inline float4 HitRecords::getAttributeValue(
+    uint32_t i, Attribute attr, const Ray &ray) const
+{
+  if (attr == Attribute::NONE)
+    return DEFAULT_ATTRIBUTE_VALUE;
+
+  const int a = static_cast<int>(attr);
+  if (m_vertexAttributeMasks[i] & (1u << a))
+    return m_geometries[i]->getAttributeValue(attr, ray);
+
+  return m_primitiveAttributes[a][i](ray.primID);
+}
+
+inline float3 HitRecords::getSurfaceColor(uint32_t i, const Ray &ray) const
+{
+  if (const auto *sampler = m_colorSamplers[i]) {
+    const auto v = sampler->getSample(*m_geometries[i], ray);
+    return float3(v.x, v.y, v.z);
+  }
+
+  const auto attr = m_colorAttributes[i];
+  if (attr == Attribute::NONE)
+    return m_colors[i];
+
+  const auto v = getAttributeValue(i, attr, ray);
+  return float3(v.x, v.y, v.z);
+}
+
+} // namespace helide
@@ -23,6 +23,7 @@ void Instance::commit()
   m_xfm = getParam<mat4>("transform", mat4(linalg::identity));
   m_xfmInvRot = linalg::inverse(extractRotation(m_xfm));
   m_group = getParamObject<Group>("group");
+  m_id = getParam<uint32_t>("id", ~0u);
   if (!m_group)
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'group' on ANARIInstance");
 }
@@ -42,6 +43,11 @@ bool Instance::xfmIsIdentity() const
   return xfm() == mat4(linalg::identity);
 }
 
+uint32_t Instance::id() const
+{
+  return m_id;
+}
+
 const Group *Instance::group() const
 {
   return m_group.ptr;
@@ -18,6 +18,9 @@ struct Instance : public Object
   const mat3 &xfmInvRot() const;
   bool xfmIsIdentity() const;
 
+  // User 'id' for the instanceId frame channel, ~0u if not set
+  uint32_t id() const;
+
   const Group *group() const;
   Group *group();
 
@@ -31,6 +34,7 @@ struct Instance : public Object
  private:
   mat4 m_xfm;
   mat3 m_xfmInvRot;
+  uint32_t m_id{~0u};
   helium::IntrusivePtr<Group> m_group;
   RTCGeometry m_embreeGeometry{nullptr};
 };
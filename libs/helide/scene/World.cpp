@@ -97,6 +97,7 @@ void World::commit()
   m_objectUpdates.lastTLSBuild = 0;
   m_objectUpdates.lastBLSReconstructCheck = 0;
   m_objectUpdates.lastBLSCommitCheck = 0;
+  m_objectUpdates.lastHitRecordsBuild = 0;
 
   if (m_instanceData)
     m_instanceData->addCommitObserver(this);
@@ -109,12 +110,27 @@ const std::vector<Instance *> &World::instances() const
   return m_instances;
 }
 
+const HitRecords &World::hitRecords() const
+{
+  return m_hitRecords;
+}
+
 void World::intersectVolumes(VolumeRay &ray) const
 {
   for (auto *i : instances())
     i->group()->intersectVolumes(ray);
 }
 
+bool World::hasSurfaces() const
+{
+  return m_hasSurfaces;
+}
+
+bool World::hasVolumes() const
+{
+  return m_hasVolumes;
+}
+
 RTCScene World::embreeScene() const
 {
   return m_embreeScene;
@@ -125,6 +141,14 @@ void World::embreeSceneUpdate()
   rebuildBLSs();
   recommitBLSs();
   rebuildTLS();
+  rebuildHitRecords();
+
+  m_hasSurfaces = false;
+  m_hasVolumes = false;
+  for (auto *i : m_instances) {
+    m_hasSurfaces |= !i->group()->surfaces().empty();
+    m_hasVolumes |= !i->group()->volumes().empty();
+  }
 }
 
 void World::rebuildBLSs()
@@ -204,6 +228,22 @@ void World::rebuildTLS()
 
   rtcCommitScene(m_embreeScene);
   m_objectUpdates.lastTLSBuild = helium::newTimeStamp();
+  m_objectUpdates.lastHitRecordsBuild = 0; // instance IDs may have changed
+}
+
+void World::rebuildHitRecords()
+{
+  const auto &state = *deviceState();
+  if (state.objectUpdates.lastHitRecordsRebuildRequest
+      < m_objectUpdates.lastHitRecordsBuild) {
+    return;
+  }
+
+  reportMessage(ANARI_SEVERITY_DEBUG, "helide::World rebuilding hit records");
+
+  const auto &imc = state.invalidMaterialColor;
+  m_hitRecords.build(m_instances, float3(imc.x, imc.y, imc.z));
+  m_objectUpdates.lastHitRecordsBuild = helium::newTimeStamp();
 }
 
 void World::cleanup()
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "HitRecords.h"
 #include "Instance.h"
 
 namespace helide {
@@ -20,9 +21,14 @@ struct World : public Object
   void commit() override;
 
   const std::vector<Instance *> &instances() const;
+  const HitRecords &hitRecords() const;
 
   void intersectVolumes(VolumeRay &ray) const;
 
+  // Whether any instance has surfaces/volumes, as of embreeSceneUpdate()
+  bool hasSurfaces() const;
+  bool hasVolumes() const;
+
   RTCScene embreeScene() const;
   void embreeSceneUpdate();
 
@@ -30,6 +36,7 @@ struct World : public Object
   void rebuildBLSs();
   void recommitBLSs();
   void rebuildTLS();
+  void rebuildHitRecords();
   void cleanup();
 
   helium::IntrusivePtr<ObjectArray> m_zeroSurfaceData;
@@ -43,6 +50,8 @@ struct World : public Object
   helium::IntrusivePtr<Instance> m_zeroInstance;
 
   size_t m_numSurfaceInstances{0};
+  bool m_hasSurfaces{false};
+  bool m_hasVolumes{false};
 
   box3 m_surfaceBounds;
 
@@ -51,8 +60,11 @@ struct World : public Object
     helium::TimeStamp lastTLSBuild{0};
     helium::TimeStamp lastBLSReconstructCheck{0};
     helium::TimeStamp lastBLSCommitCheck{0};
+    helium::TimeStamp lastHitRecordsBuild{0};
   } m_objectUpdates;
 
+  HitRecords m_hitRecords;
+
   RTCScene m_embreeScene{nullptr};
 };
 
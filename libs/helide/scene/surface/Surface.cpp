@@ -19,6 +19,7 @@ void Surface::commit()
 {
   m_geometry = getParamObject<Geometry>("geometry");
   m_material = getParamObject<Material>("material");
+  m_id = getParam<uint32_t>("id", ~0u);
 
   if (!m_material) {
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'material' on ANARISurface");
@@ -41,6 +42,11 @@ const Material *Surface::material() const
   return m_material.ptr;
 }
 
+uint32_t Surface::id() const
+{
+  return m_id;
+}
+
 float3 Surface::getSurfaceColor(const Ray &ray) const
 {
   auto &state = *deviceState();
@@ -17,6 +17,8 @@ struct Surface : public Object
 
   const Geometry *geometry() const;
   const Material *material() const;
+  // User 'id' for the objectId frame channel, ~0u if not set
+  uint32_t id() const;
 
   float3 getSurfaceColor(const Ray &ray) const;
 
@@ -26,6 +28,7 @@ struct Surface : public Object
  private:
   helium::IntrusivePtr<Geometry> m_geometry;
   helium::IntrusivePtr<Material> m_material;
+  uint32_t m_id{~0u};
 };
 
 } // namespace helide
@@ -0,0 +1,285 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CompactMesh.h"
+// std
+#include <limits>
+
+namespace helide {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+template <typename T>
+static float3 readVertexNormalized(const void *mem, uint32_t i)
+{
+  constexpr float m = std::numeric_limits<T>::max();
+  const T *v = typedOffset<T>(mem, 3 * size_t(i));
+  return linalg::max(float3(v[0] / m, v[1] / m, v[2] / m), float3(-1.f));
+}
+
+static float3 readVertexHalf(const void *mem, uint32_t i)
+{
+  const uint16_t *v = typedOffset<uint16_t>(mem, 3 * size_t(i));
+  return float3(halfToFloat(v[0]), halfToFloat(v[1]), halfToFloat(v[2]));
+}
+
+static float3 readVertexFloat(const void *mem, uint32_t i)
+{
+  return *typedOffset<float3>(mem, i);
+}
+
+template <typename T>
+static uint4 readIndex(const void *mem, uint32_t primID, int n)
+{
+  const T *idx = typedOffset<T>(mem, n * size_t(primID));
+  return uint4(idx[0], idx[1], idx[2], n == 4 ? idx[3] : 0);
+}
+
+static uint4 readIndexImplicit(const void *, uint32_t primID, int n)
+{
+  const uint32_t base = n * primID;
+  return uint4(base, base + 1, base + 2, n == 4 ? base + 3 : 0);
+}
+
+static bool intersectTriangle(const float3 &org,
+    const float3 &dir,
+    float tnear,
+    float tfar,
+    const float3 &v0,
+    const float3 &v1,
+    const float3 &v2,
+    float &t,
+    float &u,
+    float &v,
+    float3 &Ng)
+{
+  // NOTE: orientation of Ng + (u,v) follow Embree's triangle conventions
+  const float3 e1 = v0 - v1;
+  const float3 e2 = v2 - v0;
+  const float3 n = linalg::cross(e1, e2);
+
+  const float3 c = v0 - org;
+  const float3 r = linalg::cross(dir, c);
+  const float den = linalg::dot(n, dir);
+  if (den == 0.f)
+    return false;
+  const float rcpDen = 1.f / den;
+
+  const float U = linalg::dot(r, e2) * rcpDen;
+  const float V = linalg::dot(r, e1) * rcpDen;
+  if (U < 0.f || V < 0.f || U + V > 1.f)
+    return false;
+
+  const float T = linalg::dot(n, c) * rcpDen;
+  if (!(T > tnear && T < tfar))
+    return false;
+
+  t = T;
+  u = U;
+  v = V;
+  Ng = -n; // == cross(v1 - v0, v2 - v0)
+  return true;
+}
+
+static void compactMeshBounds(const RTCBoundsFunctionArguments *args)
+{
+  auto *mesh = (const CompactMesh *)args->geometryUserPtr;
+  const box3 b = mesh->bounds(args->primID);
+  auto *o = args->bounds_o;
+  o->lower_x = b.lower.x;
+  o->lower_y = b.lower.y;
+  o->lower_z = b.lower.z;
+  o->upper_x = b.upper.x;
+  o->upper_y = b.upper.y;
+  o->upper_z = b.upper.z;
+}
+
+static void compactMeshIntersect(const RTCIntersectFunctionNArguments *args)
+{
+  auto *mesh = (const CompactMesh *)args->geometryUserPtr;
+  const auto N = args->N;
+  auto *rays = RTCRayHitN_RayN(args->rayhit, N);
+  auto *hits = RTCRayHitN_HitN(args->rayhit, N);
+
+  for (unsigned int i = 0; i < N; i++) {
+    if (!args->valid[i])
+      continue;
+
+    const float3 org(RTCRayN_org_x(rays, N, i),
+        RTCRayN_org_y(rays, N, i),
+        RTCRayN_org_z(rays, N, i));
+    const float3 dir(RTCRayN_dir_x(rays, N, i),
+        RTCRayN_dir_y(rays, N, i),
+        RTCRayN_dir_z(rays, N, i));
+    float &tfar = RTCRayN_tfar(rays, N, i);
+
+    float u, v;
+    float3 Ng;
+    if (mesh->intersect(args->primID,
+            org,
+            dir,
+            RTCRayN_tnear(rays, N, i),
+            tfar,
+            u,
+            v,
+            Ng)) {
+      RTCHitN_Ng_x(hits, N, i) = Ng.x;
+      RTCHitN_Ng_y(hits, N, i) = Ng.y;
+      RTCHitN_Ng_z(hits, N, i) = Ng.z;
+      RTCHitN_u(hits, N, i) = u;
+      RTCHitN_v(hits, N, i) = v;
+      RTCHitN_primID(hits, N, i) = args->primID;
+      RTCHitN_geomID(hits, N, i) = args->geomID;
+      RTCHitN_instID(hits, N, i, 0) = args->context->instID[0];
+    }
+  }
+}
+
+static void compactMeshOccluded(const RTCOccludedFunctionNArguments *args)
+{
+  auto *mesh = (const CompactMesh *)args->geometryUserPtr;
+  const auto N = args->N;
+  auto *rays = args->ray;
+
+  for (unsigned int i = 0; i < N; i++) {
+    if (!args->valid[i])
+      continue;
+
+    const float3 org(RTCRayN_org_x(rays, N, i),
+        RTCRayN_org_y(rays, N, i),
+        RTCRayN_org_z(rays, N, i));
+    const float3 dir(RTCRayN_dir_x(rays, N, i),
+        RTCRayN_dir_y(rays, N, i),
+        RTCRayN_dir_z(rays, N, i));
+    float &tfar = RTCRayN_tfar(rays, N, i);
+
+    float u, v;
+    float3 Ng;
+    if (mesh->intersect(
+            args->primID, org, dir, RTCRayN_tnear(rays, N, i), tfar, u, v, Ng))
+      tfar = -std::numeric_limits<float>::infinity();
+  }
+}
+
+// CompactMesh definitions ////////////////////////////////////////////////////
+
+bool CompactMesh::isCompactPositionType(ANARIDataType type)
+{
+  return type == ANARI_FLOAT16_VEC3 || type == ANARI_FIXED16_VEC3
+      || type == ANARI_UFIXED16_VEC3;
+}
+
+bool CompactMesh::isCompactIndexType(ANARIDataType type)
+{
+  return type == ANARI_UINT16_VEC3 || type == ANARI_UINT16_VEC4;
+}
+
+bool CompactMesh::isValidPositionType(ANARIDataType type)
+{
+  return type == ANARI_FLOAT32_VEC3 || isCompactPositionType(type);
+}
+
+bool CompactMesh::isValidIndexType(ANARIDataType type, int n)
+{
+  if (n == 4)
+    return type == ANARI_UINT32_VEC4 || type == ANARI_UINT16_VEC4;
+  else
+    return type == ANARI_UINT32_VEC3 || type == ANARI_UINT16_VEC3;
+}
+
+void CompactMesh::setData(int n,
+    const Array1D *position,
+    const Array1D *index,
+    const float3 &scale,
+    const float3 &offset)
+{
+  m_verticesPerPrimitive = n;
+  m_position = position->begin();
+  m_index = index ? index->begin() : nullptr;
+  m_numPrimitives = index ? index->size() : position->size() / n;
+  m_scale = scale;
+  m_offset = offset;
+
+  switch (position->elementType()) {
+  case ANARI_FLOAT16_VEC3:
+    m_readVertex = readVertexHalf;
+    break;
+  case ANARI_FIXED16_VEC3:
+    m_readVertex = readVertexNormalized<int16_t>;
+    break;
+  case ANARI_UFIXED16_VEC3:
+    m_readVertex = readVertexNormalized<uint16_t>;
+    break;
+  case ANARI_FLOAT32_VEC3:
+  default:
+    m_readVertex = readVertexFloat;
+    m_scale = float3(1.f);
+    m_offset = float3(0.f);
+    break;
+  }
+
+  if (!index)
+    m_readIndex = readIndexImplicit;
+  else if (isCompactIndexType(index->elementType()))
+    m_readIndex = readIndex<uint16_t>;
+  else
+    m_readIndex = readIndex<uint32_t>;
+}
+
+void CompactMesh::attachToEmbreeGeometry(RTCGeometry g) const
+{
+  rtcSetGeometryUserPrimitiveCount(g, uint32_t(numPrimitives()));
+  rtcSetGeometryUserData(g, (void *)this);
+  rtcSetGeometryBoundsFunction(g, compactMeshBounds, nullptr);
+  rtcSetGeometryIntersectFunction(g, compactMeshIntersect);
+  rtcSetGeometryOccludedFunction(g, compactMeshOccluded);
+}
+
+bool CompactMesh::intersect(uint32_t primID,
+    const float3 &org,
+    const float3 &dir,
+    float tnear,
+    float &tfar,
+    float &u,
+    float &v,
+    float3 &Ng) const
+{
+  const uint4 idx = primitiveIndices(primID);
+  const float3 v0 = vertex(idx.x);
+  const float3 v1 = vertex(idx.y);
+  const float3 v2 = vertex(idx.z);
+
+  if (m_verticesPerPrimitive == 3)
+    return intersectTriangle(org, dir, tnear, tfar, v0, v1, v2, tfar, u, v, Ng);
+
+  // Quads are split into (v0, v1, v3) and (v2, v3, v1), mapping the hit back
+  // to the bilinear (u,v) parameterization Embree uses for quads
+  const float3 v3 = vertex(idx.w);
+  bool hit = false;
+  float tu, tv;
+  if (intersectTriangle(org, dir, tnear, tfar, v0, v1, v3, tfar, tu, tv, Ng)) {
+    u = tu;
+    v = tv;
+    hit = true;
+  }
+  if (intersectTriangle(org, dir, tnear, tfar, v2, v3, v1, tfar, tu, tv, Ng)) {
+    u = 1.f - tu;
+    v = 1.f - tv;
+    hit = true;
+  }
+  return hit;
+}
+
+box3 CompactMesh::bounds(uint32_t primID) const
+{
+  const uint4 idx = primitiveIndices(primID);
+  box3 b;
+  b.extend(vertex(idx.x));
+  b.extend(vertex(idx.y));
+  b.extend(vertex(idx.z));
+  if (m_verticesPerPrimitive == 4)
+    b.extend(vertex(idx.w));
+  return b;
+}
+
+} // namespace helide
@@ -0,0 +1,85 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "array/Array1D.h"
+// embree
+#include "embree3/rtcore.h"
+
+namespace helide {
+
+// Triangle and quad mesh data which is stored in a format Embree cannot
+// consume directly (16-bit float or fixed-point vertex positions, 16-bit
+// indices). Primitives are expanded on the fly inside an Embree user geometry,
+// trading intersection speed for a smaller memory footprint.
+struct CompactMesh
+{
+  // Return whether an array of this type needs to go through CompactMesh
+  static bool isCompactPositionType(ANARIDataType type);
+  static bool isCompactIndexType(ANARIDataType type);
+
+  // Return whether an array of this type can be used at all
+  static bool isValidPositionType(ANARIDataType type);
+  static bool isValidIndexType(ANARIDataType type, int verticesPerPrimitive);
+
+  // Update the source data -- 'index' may be null, in which case primitives
+  // are read from consecutive vertices. Quantized positions are decoded as
+  // 'offset + scale * value'.
+  void setData(int verticesPerPrimitive,
+      const Array1D *position,
+      const Array1D *index,
+      const float3 &scale,
+      const float3 &offset);
+
+  // Setup the callbacks on an Embree user geometry to intersect this mesh
+  void attachToEmbreeGeometry(RTCGeometry geometry) const;
+
+  size_t numPrimitives() const;
+
+  float3 vertex(uint32_t i) const;
+  uint4 primitiveIndices(uint32_t primID) const;
+
+  bool intersect(uint32_t primID,
+      const float3 &org,
+      const float3 &dir,
+      float tnear,
+      float &tfar,
+      float &u,
+      float &v,
+      float3 &Ng) const;
+
+  box3 bounds(uint32_t primID) const;
+
+ private:
+  using ReadVertexFcn = float3 (*)(const void *, uint32_t);
+  using ReadIndexFcn = uint4 (*)(const void *, uint32_t, int);
+
+  int m_verticesPerPrimitive{3};
+  const void *m_position{nullptr};
+  const void *m_index{nullptr};
+  size_t m_numPrimitives{0};
+  float3 m_scale{1.f};
+  float3 m_offset{0.f};
+  ReadVertexFcn m_readVertex{nullptr};
+  ReadIndexFcn m_readIndex{nullptr};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline size_t CompactMesh::numPrimitives() const
+{
+  return m_numPrimitives;
+}
+
+inline float3 CompactMesh::vertex(uint32_t i) const
+{
+  return m_offset + m_scale * m_readVertex(m_position, i);
+}
+
+inline uint4 CompactMesh::primitiveIndices(uint32_t primID) const
+{
+  return m_readIndex(m_index, primID, m_verticesPerPrimitive);
+}
+
+} // namespace helide
@@ -15,6 +15,22 @@ Cone::Cone(HelideGlobalState *s) : Geometry(s)
 
 void Cone::commit()
 {
+  auto packVertex = [&](uint32_t i) {
+    return radiusVertex(
+        m_vertexPosition.ptr, m_vertexRadius.ptr, i, m_globalRadius);
+  };
+
+  // Packed vertices match array elements 1:1 unless indexed
+  const bool updatedRegions = m_packedVertices.empty()
+      ? commitChangedRegions(m_vertexPosition.ptr, m_index.ptr)
+      : !m_index
+          && repackChangedRegions(
+              {{m_vertexPosition.ptr}, {m_vertexRadius.ptr}},
+              m_index.ptr,
+              packVertex);
+  if (updatedRegions)
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -31,46 +47,54 @@ void Cone::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on cone geometry");
+    invalidate();
     return;
   }
 
+  if (!checkElementType(m_vertexPosition.ptr,
+          {ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4},
+          "vertex.position",
+          "cone")
+      || !checkElementType(
+          m_vertexRadius.ptr, {ANARI_FLOAT32}, "vertex.radius", "cone")
+      || !checkElementType(
+          m_index.ptr, {ANARI_UINT32_VEC2}, "primitive.index", "cone"))
+    return;
+
   if (m_index)
     m_index->addCommitObserver(this);
   m_vertexPosition->addCommitObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->addCommitObserver(this);
 
-  const float *radius =
-      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numCones =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
-    auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_VERTEX,
-        0,
-        RTC_FORMAT_FLOAT4,
-        sizeof(float4),
-        numCones * 2);
+  const bool interleavedRadius =
+      m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4;
+
+  if (interleavedRadius && !m_index && !m_vertexRadius) {
+    setEmbreeVertexBuffer(m_vertexPosition->beginAs<float4>(), numCones * 2);
+  } else {
+    auto *vr = packedVertexBuffer(numCones * 2);
 
     if (m_index) {
       const auto *begin = m_index->beginAs<uint2>();
       const auto *end = m_index->endAs<uint2>();
-      const auto *v = m_vertexPosition->beginAs<float3>();
       uint32_t cID = 0;
       std::for_each(begin, end, [&](const uint2 &idx) {
-        vr[cID + 0] = float4(v[idx.x], radius ? radius[idx.x] : m_globalRadius);
-        vr[cID + 1] = float4(v[idx.y], radius ? radius[idx.y] : m_globalRadius);
+        vr[cID + 0] = packVertex(idx.x);
+        vr[cID + 1] = packVertex(idx.y);
         cID += 2;
       });
     } else {
-      const auto *begin = m_vertexPosition->beginAs<float3>();
-      const auto *end = m_vertexPosition->endAs<float3>();
-      uint32_t rID = 0;
-      std::transform(begin, end, vr, [&](const float3 &v) {
-        return float4(v, radius ? radius[rID++] : m_globalRadius);
-      });
+      for (uint32_t i = 0; i < numCones * 2; i++)
+        vr[i] = packVertex(i);
     }
+
+    commitPackedVertexBuffer();
   }
 
   {
@@ -93,15 +117,15 @@ float4 Cone::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
   auto idx = m_index ? *(m_index->dataAs<uint2>() + ray.primID)
                      : 2 * ray.primID + uint2(0, 1);
 
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
+  auto a = attributeAccessor(idx.x);
+  auto b = attributeAccessor(idx.y);
 
   return a + (b - a) * ray.u;
 }
@@ -112,6 +136,8 @@ void Cone::cleanup()
     m_index->removeCommitObserver(this);
   if (m_vertexPosition)
     m_vertexPosition->removeCommitObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->removeCommitObserver(this);
 }
 
 } // namespace helide
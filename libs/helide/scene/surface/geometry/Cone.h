@@ -22,7 +22,6 @@ struct Cone : public Geometry
   helium::IntrusivePtr<Array1D> m_index;
   helium::IntrusivePtr<Array1D> m_vertexPosition;
   helium::IntrusivePtr<Array1D> m_vertexRadius;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
   float m_globalRadius{0.f};
 };
 
@@ -15,6 +15,20 @@ Curve::Curve(HelideGlobalState *s) : Geometry(s)
 
 void Curve::commit()
 {
+  auto packVertex = [&](uint32_t i) {
+    return radiusVertex(
+        m_vertexPosition.ptr, m_vertexRadius.ptr, i, m_globalRadius);
+  };
+
+  // Packed vertices always match array elements 1:1
+  const bool updatedRegions = m_packedVertices.empty()
+      ? commitChangedRegions(m_vertexPosition.ptr, m_index.ptr)
+      : repackChangedRegions({{m_vertexPosition.ptr}, {m_vertexRadius.ptr}},
+          m_index.ptr,
+          packVertex);
+  if (updatedRegions)
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -31,34 +45,41 @@ void Curve::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on curve geometry");
+    invalidate();
     return;
   }
 
+  if (!checkElementType(m_vertexPosition.ptr,
+          {ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4},
+          "vertex.position",
+          "curve")
+      || !checkElementType(
+          m_vertexRadius.ptr, {ANARI_FLOAT32}, "vertex.radius", "curve")
+      || !checkElementType(
+          m_index.ptr, {ANARI_UINT32}, "primitive.index", "curve"))
+    return;
+
   if (m_index)
     m_index->addCommitObserver(this);
   m_vertexPosition->addCommitObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->addCommitObserver(this);
 
-  const float *radius =
-      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numSegments =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
-    auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_VERTEX,
-        0,
-        RTC_FORMAT_FLOAT4,
-        sizeof(float4),
-        m_vertexPosition->size());
-
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-    uint32_t rID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      return float4(v, radius ? radius[rID++] : m_globalRadius);
-    });
+  if (m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4
+      && !m_vertexRadius) {
+    setEmbreeVertexBuffer(
+        m_vertexPosition->beginAs<float4>(), m_vertexPosition->size());
+  } else {
+    auto *vr = packedVertexBuffer(m_vertexPosition->size());
+    for (uint32_t i = 0; i < m_vertexPosition->size(); i++)
+      vr[i] = packVertex(i);
+
+    commitPackedVertexBuffer();
   }
 
   if (m_index) {
@@ -89,14 +110,14 @@ float4 Curve::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
   auto idx = m_index ? *(m_index->dataAs<uint32_t>() + ray.primID) : ray.primID;
 
-  auto a = readAttributeValue(attributeArray, idx + 0);
-  auto b = readAttributeValue(attributeArray, idx + 1);
+  auto a = attributeAccessor(idx + 0);
+  auto b = attributeAccessor(idx + 1);
 
   return a + (b - a) * ray.u;
 }
@@ -107,6 +128,8 @@ void Curve::cleanup()
     m_index->removeCommitObserver(this);
   if (m_vertexPosition)
     m_vertexPosition->removeCommitObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->removeCommitObserver(this);
 }
 
 } // namespace helide
@@ -15,6 +15,25 @@ Cylinder::Cylinder(HelideGlobalState *s) : Geometry(s)
 
 void Cylinder::commit()
 {
+  // Radii are per cylinder, so each one goes into both of its vertices
+  auto vertexAt = [&](uint32_t i, uint32_t primID) {
+    const float4 v =
+        radiusVertex(m_vertexPosition.ptr, nullptr, i, m_globalRadius);
+    if (m_radius)
+      return float4(v.xyz(), ((const float *)m_radius->begin())[primID]);
+    return v;
+  };
+
+  // Packed vertices follow array elements unless indexed
+  const bool updatedRegions = m_packedVertices.empty()
+      ? commitChangedRegions(m_vertexPosition.ptr, m_index.ptr)
+      : !m_index
+          && repackChangedRegions({{m_vertexPosition.ptr}, {m_radius.ptr, 2}},
+              m_index.ptr,
+              [&](uint32_t i) { return vertexAt(i, i / 2); });
+  if (updatedRegions)
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -31,47 +50,55 @@ void Cylinder::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on cylinder geometry");
+    invalidate();
     return;
   }
 
+  if (!checkElementType(m_vertexPosition.ptr,
+          {ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4},
+          "vertex.position",
+          "cylinder")
+      || !checkElementType(
+          m_radius.ptr, {ANARI_FLOAT32}, "primitive.radius", "cylinder")
+      || !checkElementType(
+          m_index.ptr, {ANARI_UINT32_VEC2}, "primitive.index", "cylinder"))
+    return;
+
   if (m_index)
     m_index->addCommitObserver(this);
   m_vertexPosition->addCommitObserver(this);
+  if (m_radius)
+    m_radius->addCommitObserver(this);
 
-  const float *radius = m_radius ? m_radius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numCylinders =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
-    auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_VERTEX,
-        0,
-        RTC_FORMAT_FLOAT4,
-        sizeof(float4),
-        numCylinders * 2);
+  const bool interleavedRadius =
+      m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4;
+
+  if (interleavedRadius && !m_index && !m_radius) {
+    setEmbreeVertexBuffer(
+        m_vertexPosition->beginAs<float4>(), numCylinders * 2);
+  } else {
+    auto *vr = packedVertexBuffer(numCylinders * 2);
 
     if (m_index) {
       const auto *begin = m_index->beginAs<uint2>();
       const auto *end = m_index->endAs<uint2>();
-      const auto *v = m_vertexPosition->beginAs<float3>();
       uint32_t cID = 0;
       std::for_each(begin, end, [&](const uint2 &idx) {
-        vr[cID + 0] =
-            float4(v[idx.x], radius ? radius[cID / 2] : m_globalRadius);
-        vr[cID + 1] =
-            float4(v[idx.y], radius ? radius[cID / 2] : m_globalRadius);
+        vr[cID + 0] = vertexAt(idx.x, cID / 2);
+        vr[cID + 1] = vertexAt(idx.y, cID / 2);
         cID += 2;
       });
     } else {
-      const auto *begin = m_vertexPosition->beginAs<float3>();
-      const auto *end = m_vertexPosition->endAs<float3>();
-      uint32_t rID = 0;
-      std::transform(begin, end, vr, [&](const float3 &v) {
-        return float4(v, radius ? radius[rID++ / 2] : m_globalRadius);
-      });
+      for (uint32_t i = 0; i < numCylinders * 2; i++)
+        vr[i] = vertexAt(i, i / 2);
     }
+
+    commitPackedVertexBuffer();
   }
 
   {
@@ -94,15 +121,15 @@ float4 Cylinder::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
   auto idx = m_index ? *(m_index->dataAs<uint2>() + ray.primID)
                      : 2 * ray.primID + uint2(0, 1);
 
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
+  auto a = attributeAccessor(idx.x);
+  auto b = attributeAccessor(idx.y);
 
   return a + (b - a) * ray.u;
 }
@@ -113,6 +140,8 @@ void Cylinder::cleanup()
     m_index->removeCommitObserver(this);
   if (m_vertexPosition)
     m_vertexPosition->removeCommitObserver(this);
+  if (m_radius)
+    m_radius->removeCommitObserver(this);
 }
 
 } // namespace helide
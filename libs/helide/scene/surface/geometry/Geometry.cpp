@@ -10,8 +10,10 @@
 #include "Sphere.h"
 #include "Triangle.h"
 // std
+#include <algorithm>
 #include <cstring>
 #include <limits>
+#include <typeinfo>
 
 namespace helide {
 
@@ -22,6 +24,7 @@ Geometry::Geometry(HelideGlobalState *s) : Object(ANARI_GEOMETRY, s)
 
 Geometry::~Geometry()
 {
+  removeAttributeObservers();
   rtcReleaseGeometry(m_embreeGeometry);
   deviceState()->objectCounts.geometries--;
 }
@@ -52,18 +55,68 @@ RTCGeometry Geometry::embreeGeometry() const
 
 void Geometry::commit()
 {
+  removeAttributeObservers();
+
+  // Groups have to pick the geometry up again if it was left out
+  if (!m_valid) {
+    m_valid = true;
+    deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+        helium::newTimeStamp();
+  }
+
+  // A full commit may change topology, which refitting can't handle
+  rtcSetGeometryBuildQuality(m_embreeGeometry, RTC_BUILD_QUALITY_MEDIUM);
+
   m_attributes[0] = getParamObject<Array1D>("primitive.attribute0");
   m_attributes[1] = getParamObject<Array1D>("primitive.attribute1");
   m_attributes[2] = getParamObject<Array1D>("primitive.attribute2");
   m_attributes[3] = getParamObject<Array1D>("primitive.attribute3");
   m_attributes[4] = getParamObject<Array1D>("primitive.color");
+
+  updateDefinition();
 }
 
 void Geometry::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastBLSCommitSceneRequest =
-      helium::newTimeStamp();
+  m_changedRegions.clear();
+  resolveAttributeAccessors();
+  auto &state = *deviceState();
+  state.objectUpdates.lastBLSCommitSceneRequest = helium::newTimeStamp();
+  state.objectUpdates.lastHitRecordsRebuildRequest = helium::newTimeStamp();
+  if (state.deduplicateData) {
+    // Shared BLSs may reference this geometry, so they can't be recommitted
+    state.dedupCache.invalidateScenes();
+    state.objectUpdates.lastBLSReconstructSceneRequest =
+        helium::newTimeStamp();
+  }
+}
+
+bool Geometry::isValid() const
+{
+  return m_valid;
+}
+
+void Geometry::arrayRegionChanged(
+    const Array *array, size_t begin, size_t end)
+{
+  // Regions only add up while nothing else changed since the last commit
+  const bool wasCommitted =
+      lastCommitted() != 0 && lastUpdated() <= lastCommitted();
+  const bool onlyRegions = onlyRegionsChanged();
+
+  markUpdated();
+
+  if (wasCommitted || onlyRegions) {
+    m_changedRegions.push_back({array, begin, end});
+    m_regionsUpdated = lastUpdated();
+  } else
+    m_changedRegions.clear();
+}
+
+bool Geometry::hasDynamicVertices() const
+{
+  return m_dynamicVertices;
 }
 
 float4 Geometry::getAttributeValue(const Attribute &attr, const Ray &ray) const
@@ -72,7 +125,291 @@ float4 Geometry::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  return readAttributeValue(m_attributes[attrIdx].ptr, ray.primID);
+  return m_attributeAccessors[attrIdx](ray.primID);
+}
+
+float Geometry::attributeDensity(const Attribute &, const Ray &) const
+{
+  return 0.f;
+}
+
+bool Geometry::commitChangedRegions(
+    const Array *vertexPosition, const Array *index)
+{
+  if (!onlyRegionsChanged())
+    return false;
+
+  bool positionsChanged = false;
+  size_t numElements = 0;
+  for (const auto &r : m_changedRegions) {
+    if (r.array == index)
+      return false;
+    positionsChanged |= r.array == vertexPosition;
+    numElements += r.end - r.begin;
+  }
+
+  if (positionsChanged) {
+    // Compact meshes are user geometries computing their own bounds
+    if (m_embreeGeometryType == RTC_GEOMETRY_TYPE_USER)
+      return false;
+    refitVertexBuffer();
+  }
+
+  commitRegions(numElements);
+  return true;
+}
+
+bool Geometry::repackChangedRegions(
+    std::initializer_list<PackedVertexSource> sources,
+    const Array *index,
+    const std::function<float4(uint32_t)> &packVertex)
+{
+  if (!onlyRegionsChanged() || m_packedVertices.empty())
+    return false;
+
+  for (const auto &r : m_changedRegions) {
+    if (r.array == index)
+      return false;
+  }
+
+  bool repacked = false;
+  size_t numElements = 0;
+  for (const auto &r : m_changedRegions) {
+    auto source = std::find_if(sources.begin(), sources.end(), [&](auto &s) {
+      return s.array && s.array == r.array;
+    });
+    if (source == sources.end())
+      continue;
+
+    // Regions count from the start of the array, packing from its 'begin'
+    const auto *array = source->array;
+    const size_t first = ((const uint8_t *)array->begin()
+                             - (const uint8_t *)array->data())
+        / anari::sizeOf(array->elementType());
+    const size_t begin = std::max(r.begin, first) - first;
+    const size_t end = std::min(r.end - std::min(r.end, first), array->size());
+
+    const size_t numVertices = m_packedVertices.size();
+    const size_t v0 = std::min(begin * source->verticesPerElement, numVertices);
+    const size_t v1 = std::min(end * source->verticesPerElement, numVertices);
+    for (size_t v = v0; v < v1; v++)
+      m_packedVertices[v] = packVertex(uint32_t(v));
+
+    repacked = true;
+    numElements += end > begin ? end - begin : 0;
+  }
+
+  if (repacked)
+    refitVertexBuffer();
+
+  commitRegions(numElements);
+  return true;
+}
+
+void Geometry::resolveAttributeAccessors()
+{
+  auto resolve = [&](Array1D *array) {
+    if (!array)
+      return AttributeAccessor();
+    // Accessors point into array memory, which moves if the array is
+    // privatized or remapped
+    array->addCommitObserver(this);
+    return array->attributeAccessor();
+  };
+
+  for (size_t i = 0; i < m_attributes.size(); i++) {
+    m_attributeAccessors[i] = resolve(m_attributes[i].ptr);
+    m_vertexAttributeAccessors[i] = resolve(m_vertexAttributes[i].ptr);
+  }
+}
+
+void Geometry::removeAttributeObservers()
+{
+  for (auto &a : m_attributes) {
+    if (a)
+      a->removeCommitObserver(this);
+  }
+  for (auto &a : m_vertexAttributes) {
+    if (a)
+      a->removeCommitObserver(this);
+  }
+}
+
+bool Geometry::onlyRegionsChanged() const
+{
+  return m_valid && !m_changedRegions.empty()
+      && lastUpdated() == m_regionsUpdated;
+}
+
+void Geometry::refitVertexBuffer()
+{
+  // Groups have to build a scene which refits geometries first
+  if (!m_dynamicVertices) {
+    m_dynamicVertices = true;
+    deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+        helium::newTimeStamp();
+  }
+
+  rtcUpdateGeometryBuffer(m_embreeGeometry, RTC_BUFFER_TYPE_VERTEX, 0);
+  rtcSetGeometryBuildQuality(m_embreeGeometry, RTC_BUILD_QUALITY_REFIT);
+}
+
+void Geometry::commitRegions(size_t numElements)
+{
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "helide::Geometry updating %zu changed array elements in place",
+      numElements);
+
+  // Accessors are resolved again in markCommitted()
+  removeAttributeObservers();
+  rtcCommitGeometry(m_embreeGeometry);
+}
+
+const std::string &Geometry::definition() const
+{
+  return m_definition;
+}
+
+uint64_t Geometry::definitionHash() const
+{
+  return m_definitionHash;
+}
+
+void Geometry::updateDefinition()
+{
+  auto &d = m_definition;
+  d.clear();
+
+  auto append = [&](const void *mem, size_t numBytes) {
+    d.append((const char *)mem, numBytes);
+  };
+  // Variable length values are prefixed by their size to stay unambiguous
+  auto appendString = [&](std::string_view str) {
+    const size_t size = str.size();
+    append(&size, sizeof(size));
+    append(str.data(), size);
+  };
+
+  appendString(typeid(*this).name());
+
+  std::for_each(params_begin(), params_end(), [&](auto &p) {
+    const auto &value = p.second;
+    const ANARIDataType type = value.type();
+    appendString(p.first.str());
+    append(&type, sizeof(type));
+
+    if (type == ANARI_STRING) {
+      appendString(value.getString());
+    } else if (type == ANARI_ARRAY1D) {
+      const auto *array = value.template getObject<Array1D>();
+      const void *mem = array ? array->begin() : nullptr;
+      const size_t size = array ? array->size() : 0;
+      const ANARIDataType elementType =
+          array ? array->elementType() : ANARI_UNKNOWN;
+      append(&mem, sizeof(mem));
+      append(&size, sizeof(size));
+      append(&elementType, sizeof(elementType));
+    } else if (anari::isObject(type)) {
+      const auto *obj = value.template getObject<Object>();
+      append(&obj, sizeof(obj));
+    } else if (type != ANARI_UNKNOWN) {
+      append(value.data(), anari::sizeOf(type));
+    }
+  });
+
+  m_definitionHash = hashBytes(d.data(), d.size());
+}
+
+void Geometry::setEmbreeGeometryType(RTCGeometryType type)
+{
+  if (m_embreeGeometry && m_embreeGeometryType == type)
+    return;
+
+  rtcReleaseGeometry(m_embreeGeometry);
+  m_embreeGeometry = rtcNewGeometry(deviceState()->embreeDevice, type);
+  m_embreeGeometryType = type;
+  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+      helium::newTimeStamp();
+}
+
+void Geometry::invalidate()
+{
+  rtcReleaseGeometry(m_embreeGeometry);
+  m_embreeGeometry =
+      rtcNewGeometry(deviceState()->embreeDevice, m_embreeGeometryType);
+  m_packedVertices.clear();
+  m_packedVertices.shrink_to_fit();
+  m_valid = false;
+  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+      helium::newTimeStamp();
+}
+
+bool Geometry::checkElementType(const Array1D *array,
+    std::initializer_list<ANARIDataType> types,
+    const char *parameter,
+    const char *geometry)
+{
+  if (!array
+      || std::find(types.begin(), types.end(), array->elementType())
+          != types.end())
+    return true;
+
+  reportMessage(ANARI_SEVERITY_ERROR,
+      "unsupported element type '%s' for '%s' on %s geometry",
+      anari::toString(array->elementType()),
+      parameter,
+      geometry);
+  invalidate();
+  return false;
+}
+
+void Geometry::setEmbreeVertexBuffer(const float4 *vertices, size_t numVertices)
+{
+  m_packedVertices.clear();
+  m_packedVertices.shrink_to_fit();
+  rtcSetSharedGeometryBuffer(embreeGeometry(),
+      RTC_BUFFER_TYPE_VERTEX,
+      0,
+      RTC_FORMAT_FLOAT4,
+      vertices,
+      0,
+      sizeof(float4),
+      numVertices);
+}
+
+float4 *Geometry::packedVertexBuffer(size_t numVertices)
+{
+  if (m_packedVertices.size() != numVertices)
+    m_packedVertices.resize(numVertices);
+  return m_packedVertices.data();
+}
+
+float4 Geometry::radiusVertex(const Array1D *positions,
+    const Array1D *radii,
+    uint32_t i,
+    float globalRadius)
+{
+  float4 v;
+  if (positions->elementType() == ANARI_FLOAT32_VEC4)
+    v = ((const float4 *)positions->begin())[i];
+  else
+    v = float4(((const float3 *)positions->begin())[i], globalRadius);
+  if (radii)
+    v.w = ((const float *)radii->begin())[i];
+  return v;
+}
+
+void Geometry::commitPackedVertexBuffer()
+{
+  rtcSetSharedGeometryBuffer(embreeGeometry(),
+      RTC_BUFFER_TYPE_VERTEX,
+      0,
+      RTC_FORMAT_FLOAT4,
+      m_packedVertices.data(),
+      0,
+      sizeof(float4),
+      m_packedVertices.size());
+  rtcUpdateGeometryBuffer(embreeGeometry(), RTC_BUFFER_TYPE_VERTEX, 0);
 }
 
 } // namespace helide
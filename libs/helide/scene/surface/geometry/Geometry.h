@@ -6,6 +6,10 @@
 #include "array/Array1D.h"
 // std
 #include <array>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
 
 namespace helide {
 
@@ -21,17 +25,134 @@ struct Geometry : public Object
 
   void commit() override;
   void markCommitted() override;
+  bool isValid() const override;
+
+  void arrayRegionChanged(
+      const Array *array, size_t begin, size_t end) override;
+
+  // Whether vertex positions were updated in place before, in which case
+  // groups build a scene which can refit this geometry's BVH
+  bool hasDynamicVertices() const;
 
   virtual float4 getAttributeValue(
       const Attribute &attr, const Ray &ray) const;
+  // Change of the (x, y) components of a vertex attribute per unit of object
+  // space distance across the hit primitive, used to estimate texture
+  // footprints -- 0 if unknown
+  virtual float attributeDensity(const Attribute &attr, const Ray &ray) const;
+
+  const Array1D *vertexAttribute(Attribute attr) const;
+  const AttributeAccessor &primitiveAttributeAccessor(Attribute attr) const;
+
+  // Subtype and all parameter values (arrays by data pointer, which is
+  // content based for deduplicated arrays) as bytes which compare equal for
+  // identical geometries, and their hash -- used to share BLSs
+  const std::string &definition() const;
+  uint64_t definitionHash() const;
 
  protected:
+  // Replace the underlying Embree geometry if it is not already of the given
+  // type, requesting a BLS rebuild so groups re-attach the new handle
+  void setEmbreeGeometryType(RTCGeometryType type);
+
+  // Drop all buffers of the Embree geometry after a failed commit and mark
+  // this geometry invalid until the next commit, so groups leave it out
+  void invalidate();
+
+  // Report an error and invalidate() unless 'array' is unset or its element
+  // type is one of 'types', returning whether it was accepted
+  bool checkElementType(const Array1D *array,
+      std::initializer_list<ANARIDataType> types,
+      const char *parameter,
+      const char *geometry);
+
+  // Embree's sphere and curve primitives take position + radius interleaved
+  // as float4 vertices. Arrays already in that layout are shared directly with
+  // Embree, otherwise a packed copy is kept here and reused across commits.
+  void setEmbreeVertexBuffer(const float4 *vertices, size_t numVertices);
+  float4 *packedVertexBuffer(size_t numVertices);
+  void commitPackedVertexBuffer();
+
+  // Vertex i of 'positions' (float3, or float4 with interleaved radius) with
+  // the radius taken from 'radii' (float) if set, else the interleaved one,
+  // else 'globalRadius' -- element types have to be checked at commit
+  static float4 radiusVertex(const Array1D *positions,
+      const Array1D *radii,
+      uint32_t i,
+      float globalRadius);
+
+  // If only array regions changed since the last commit, update the Embree
+  // geometry for them and return true: changed vertex positions are refit
+  // in place, other vertex and primitive attributes are read directly from
+  // array memory. Returns false if a full commit is needed instead.
+  bool commitChangedRegions(const Array *vertexPosition, const Array *index);
+
+  // Array whose element i goes into 'verticesPerElement' consecutive packed
+  // vertices, starting at packed vertex i * verticesPerElement
+  struct PackedVertexSource
+  {
+    const Array1D *array{nullptr};
+    uint32_t verticesPerElement{1};
+  };
+
+  // Like commitChangedRegions() for geometries using packedVertexBuffer():
+  // packed vertices built from changed elements of 'sources' are recomputed
+  // with 'packVertex' and refit, instead of repacking the whole buffer
+  bool repackChangedRegions(std::initializer_list<PackedVertexSource> sources,
+      const Array *index,
+      const std::function<float4(uint32_t)> &packVertex);
 
   RTCGeometry m_embreeGeometry{nullptr};
+  RTCGeometryType m_embreeGeometryType{RTC_GEOMETRY_TYPE_TRIANGLE};
+  std::vector<float4> m_packedVertices;
 
   std::array<helium::IntrusivePtr<Array1D>, 5> m_attributes;
+  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
+
+  // Resolved from the above arrays on every commit
+  std::array<AttributeAccessor, 5> m_attributeAccessors;
+  std::array<AttributeAccessor, 5> m_vertexAttributeAccessors;
+
+ private:
+  void resolveAttributeAccessors();
+  void removeAttributeObservers();
+  void updateDefinition();
+  bool onlyRegionsChanged() const;
+  void refitVertexBuffer();
+  void commitRegions(size_t numElements);
+
+  std::string m_definition;
+  uint64_t m_definitionHash{0};
+  bool m_valid{true};
+
+  struct ArrayRegion
+  {
+    const Array *array{nullptr};
+    size_t begin{0};
+    size_t end{0};
+  };
+
+  // Changes since the last commit, valid while lastUpdated() is unchanged
+  std::vector<ArrayRegion> m_changedRegions;
+  helium::TimeStamp m_regionsUpdated{0};
+  bool m_dynamicVertices{false};
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline const Array1D *Geometry::vertexAttribute(Attribute attr) const
+{
+  return attr == Attribute::NONE
+      ? nullptr
+      : m_vertexAttributes[static_cast<int>(attr)].ptr;
+}
+
+inline const AttributeAccessor &Geometry::primitiveAttributeAccessor(
+    Attribute attr) const
+{
+  return m_attributeAccessors[static_cast<int>(attr)];
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(helide::Geometry *, ANARI_GEOMETRY);
@@ -9,11 +9,14 @@ namespace helide {
 
 Quad::Quad(HelideGlobalState *s) : Geometry(s)
 {
-  m_embreeGeometry = rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_QUAD);
+  setEmbreeGeometryType(RTC_GEOMETRY_TYPE_QUAD);
 }
 
 void Quad::commit()
 {
+  if (commitChangedRegions(m_vertexPosition.ptr, m_index.ptr))
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -29,6 +32,7 @@ void Quad::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on quad geometry");
+    invalidate();
     return;
   }
 
@@ -36,6 +40,45 @@ void Quad::commit()
   if (m_index)
     m_index->addCommitObserver(this);
 
+  if (!CompactMesh::isValidPositionType(m_vertexPosition->elementType())) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "unsupported element type '%s' for 'vertex.position' on quad "
+        "geometry",
+        anari::toString(m_vertexPosition->elementType()));
+    invalidate();
+    return;
+  }
+
+  if (m_index && !CompactMesh::isValidIndexType(m_index->elementType(), 4)) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "unsupported element type '%s' for 'primitive.index' on quad "
+        "geometry",
+        anari::toString(m_index->elementType()));
+    invalidate();
+    return;
+  }
+
+  const bool compact =
+      CompactMesh::isCompactPositionType(m_vertexPosition->elementType())
+      || (m_index && CompactMesh::isCompactIndexType(m_index->elementType()));
+
+  // Resolves the position and index readers used for attribute lookups on
+  // every mesh, not only for intersecting compact ones
+  m_compactMesh.setData(4,
+      m_vertexPosition.ptr,
+      m_index.ptr,
+      getParam<float3>("vertex.position.scale", float3(1.f)),
+      getParam<float3>("vertex.position.offset", float3(0.f)));
+
+  if (compact) {
+    setEmbreeGeometryType(RTC_GEOMETRY_TYPE_USER);
+    m_compactMesh.attachToEmbreeGeometry(embreeGeometry());
+    rtcCommitGeometry(embreeGeometry());
+    return;
+  }
+
+  setEmbreeGeometryType(RTC_GEOMETRY_TYPE_QUAD);
+
   rtcSetSharedGeometryBuffer(embreeGeometry(),
       RTC_BUFFER_TYPE_VERTEX,
       0,
@@ -74,28 +117,56 @@ float4 Quad::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
   const float3 uvw(1.0f - ray.u - ray.v, ray.u, ray.v);
 
-  auto idx = m_index ? *(m_index->dataAs<uint4>() + ray.primID)
-                     : 4 * ray.primID + uint4(0, 1, 2, 3);
+  const uint4 idx = m_compactMesh.primitiveIndices(ray.primID);
 
   float4 uv((1 - ray.v) * (1 - ray.u),
       (1 - ray.v) * ray.u,
       ray.v * ray.u,
       ray.v * (1 - ray.u));
 
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
-  auto c = readAttributeValue(attributeArray, idx.z);
-  auto d = readAttributeValue(attributeArray, idx.w);
+  auto a = attributeAccessor(idx.x);
+  auto b = attributeAccessor(idx.y);
+  auto c = attributeAccessor(idx.z);
+  auto d = attributeAccessor(idx.w);
 
   return uv.x * a + uv.y * b + uv.z * c + uv.w * d;
 }
 
+float Quad::attributeDensity(const Attribute &attr, const Ray &ray) const
+{
+  if (attr == Attribute::NONE)
+    return 0.f;
+
+  const auto &attributeAccessor =
+      m_vertexAttributeAccessors[static_cast<int>(attr)];
+  if (!attributeAccessor)
+    return 0.f;
+
+  const uint4 idx = m_compactMesh.primitiveIndices(ray.primID);
+
+  // Areas spanned by the diagonals
+  const float3 p0 = m_compactMesh.vertex(idx.x);
+  const float3 p1 = m_compactMesh.vertex(idx.y);
+  const float3 p2 = m_compactMesh.vertex(idx.z);
+  const float3 p3 = m_compactMesh.vertex(idx.w);
+  const float2 t0 = attributeAccessor(idx.x).xy();
+  const float2 t1 = attributeAccessor(idx.y).xy();
+  const float2 t2 = attributeAccessor(idx.z).xy();
+  const float2 t3 = attributeAccessor(idx.w).xy();
+
+  const float objectArea = length(cross(p2 - p0, p3 - p1));
+  const float attributeArea = std::abs(cross(t2 - t0, t3 - t1));
+
+  return objectArea > 0.f ? std::sqrt(attributeArea / objectArea) : 0.f;
+}
+
+
 void Quad::cleanup()
 {
   if (m_index)
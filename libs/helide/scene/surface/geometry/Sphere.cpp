@@ -13,6 +13,22 @@ Sphere::Sphere(HelideGlobalState *s) : Geometry(s)
 
 void Sphere::commit()
 {
+  auto packVertex = [&](uint32_t i) {
+    return radiusVertex(
+        m_vertexPosition.ptr, m_vertexRadius.ptr, i, m_globalRadius);
+  };
+
+  // Packed vertices match array elements 1:1 unless indexed
+  const bool updatedRegions = m_packedVertices.empty()
+      ? commitChangedRegions(m_vertexPosition.ptr, m_index.ptr)
+      : !m_index
+          && repackChangedRegions(
+              {{m_vertexPosition.ptr}, {m_vertexRadius.ptr}},
+              m_index.ptr,
+              packVertex);
+  if (updatedRegions)
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -29,9 +45,20 @@ void Sphere::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on sphere geometry");
+    invalidate();
     return;
   }
 
+  if (!checkElementType(m_vertexPosition.ptr,
+          {ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4},
+          "vertex.position",
+          "sphere")
+      || !checkElementType(
+          m_vertexRadius.ptr, {ANARI_FLOAT32}, "vertex.radius", "sphere")
+      || !checkElementType(
+          m_index.ptr, {ANARI_UINT32}, "primitive.index", "sphere"))
+    return;
+
   m_vertexPosition->addCommitObserver(this);
   if (m_vertexRadius)
     m_vertexRadius->addCommitObserver(this);
@@ -40,39 +67,28 @@ void Sphere::commit()
 
   m_globalRadius = getParam<float>("radius", 0.01f);
 
-  const float *radius = nullptr;
-  if (m_vertexRadius)
-    radius = m_vertexRadius->beginAs<float>();
-
-  const auto numSpheres = m_index ? m_index->size() : m_vertexPosition->size();
-
-  auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-      RTC_BUFFER_TYPE_VERTEX,
-      0,
-      RTC_FORMAT_FLOAT4,
-      sizeof(float4),
-      numSpheres);
-
-  if (m_index) {
-    const auto *begin = m_index->beginAs<uint32_t>();
-    const auto *end = m_index->endAs<uint32_t>();
-    const auto *vertices = m_vertexPosition->beginAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](uint32_t i) {
-      const auto &v = vertices[i];
-      const float r = radius ? radius[i] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
+  const bool interleavedRadius =
+      m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4;
+
+  if (interleavedRadius && !m_index && !m_vertexRadius) {
+    setEmbreeVertexBuffer(
+        m_vertexPosition->beginAs<float4>(), m_vertexPosition->size());
   } else {
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      const float r = radius ? radius[sphereID++] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
+    const auto numSpheres =
+        m_index ? m_index->size() : m_vertexPosition->size();
+
+    auto *vr = packedVertexBuffer(numSpheres);
+
+    if (m_index) {
+      const auto *begin = m_index->beginAs<uint32_t>();
+      const auto *end = m_index->endAs<uint32_t>();
+      std::transform(begin, end, vr, packVertex);
+    } else {
+      for (uint32_t i = 0; i < numSpheres; i++)
+        vr[i] = packVertex(i);
+    }
+
+    commitPackedVertexBuffer();
   }
 
   rtcCommitGeometry(embreeGeometry());
@@ -84,11 +100,11 @@ float4 Sphere::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return Geometry::getAttributeValue(attr, ray);
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
-  return readAttributeValue(attributeArray, ray.primID);
+  return attributeAccessor(ray.primID);
 }
 
 void Sphere::cleanup()
@@ -9,12 +9,14 @@ namespace helide {
 
 Triangle::Triangle(HelideGlobalState *s) : Geometry(s)
 {
-  m_embreeGeometry =
-      rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_TRIANGLE);
+  setEmbreeGeometryType(RTC_GEOMETRY_TYPE_TRIANGLE);
 }
 
 void Triangle::commit()
 {
+  if (commitChangedRegions(m_vertexPosition.ptr, m_index.ptr))
+    return;
+
   Geometry::commit();
 
   cleanup();
@@ -30,6 +32,7 @@ void Triangle::commit()
   if (!m_vertexPosition) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "missing required parameter 'vertex.position' on triangle geometry");
+    invalidate();
     return;
   }
 
@@ -37,6 +40,45 @@ void Triangle::commit()
   if (m_index)
     m_index->addCommitObserver(this);
 
+  if (!CompactMesh::isValidPositionType(m_vertexPosition->elementType())) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "unsupported element type '%s' for 'vertex.position' on triangle "
+        "geometry",
+        anari::toString(m_vertexPosition->elementType()));
+    invalidate();
+    return;
+  }
+
+  if (m_index && !CompactMesh::isValidIndexType(m_index->elementType(), 3)) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "unsupported element type '%s' for 'primitive.index' on triangle "
+        "geometry",
+        anari::toString(m_index->elementType()));
+    invalidate();
+    return;
+  }
+
+  const bool compact =
+      CompactMesh::isCompactPositionType(m_vertexPosition->elementType())
+      || (m_index && CompactMesh::isCompactIndexType(m_index->elementType()));
+
+  // Resolves the position and index readers used for attribute lookups on
+  // every mesh, not only for intersecting compact ones
+  m_compactMesh.setData(3,
+      m_vertexPosition.ptr,
+      m_index.ptr,
+      getParam<float3>("vertex.position.scale", float3(1.f)),
+      getParam<float3>("vertex.position.offset", float3(0.f)));
+
+  if (compact) {
+    setEmbreeGeometryType(RTC_GEOMETRY_TYPE_USER);
+    m_compactMesh.attachToEmbreeGeometry(embreeGeometry());
+    rtcCommitGeometry(embreeGeometry());
+    return;
+  }
+
+  setEmbreeGeometryType(RTC_GEOMETRY_TYPE_TRIANGLE);
+
   rtcSetSharedGeometryBuffer(embreeGeometry(),
       RTC_BUFFER_TYPE_VERTEX,
       0,
@@ -75,22 +117,47 @@ float4 Triangle::getAttributeValue(const Attribute &attr, const Ray &ray) const
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
+  const auto &attributeAccessor = m_vertexAttributeAccessors[attrIdx];
+  if (!attributeAccessor)
     return Geometry::getAttributeValue(attr, ray);
 
   const float3 uvw(1.0f - ray.u - ray.v, ray.u, ray.v);
 
-  auto idx = m_index ? *(m_index->dataAs<uint3>() + ray.primID)
-                     : 3 * ray.primID + uint3(0, 1, 2);
+  const uint3 idx = m_compactMesh.primitiveIndices(ray.primID).xyz();
 
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
-  auto c = readAttributeValue(attributeArray, idx.z);
+  auto a = attributeAccessor(idx.x);
+  auto b = attributeAccessor(idx.y);
+  auto c = attributeAccessor(idx.z);
 
   return uvw.x * a + uvw.y * b + uvw.z * c;
 }
 
+float Triangle::attributeDensity(const Attribute &attr, const Ray &ray) const
+{
+  if (attr == Attribute::NONE)
+    return 0.f;
+
+  const auto &attributeAccessor =
+      m_vertexAttributeAccessors[static_cast<int>(attr)];
+  if (!attributeAccessor)
+    return 0.f;
+
+  const uint3 idx = m_compactMesh.primitiveIndices(ray.primID).xyz();
+
+  const float3 p0 = m_compactMesh.vertex(idx.x);
+  const float3 p1 = m_compactMesh.vertex(idx.y);
+  const float3 p2 = m_compactMesh.vertex(idx.z);
+  const float2 t0 = attributeAccessor(idx.x).xy();
+  const float2 t1 = attributeAccessor(idx.y).xy();
+  const float2 t2 = attributeAccessor(idx.z).xy();
+
+  const float objectArea = length(cross(p1 - p0, p2 - p0));
+  const float attributeArea = std::abs(cross(t1 - t0, t2 - t0));
+
+  return objectArea > 0.f ? std::sqrt(attributeArea / objectArea) : 0.f;
+}
+
+
 void Triangle::cleanup()
 {
   if (m_index)
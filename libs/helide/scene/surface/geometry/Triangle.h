@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "CompactMesh.h"
 #include "Geometry.h"
 
 namespace helide {
@@ -15,13 +16,15 @@ struct Triangle : public Geometry
 
   float4 getAttributeValue(
       const Attribute &attr, const Ray &ray) const override;
+  float attributeDensity(
+      const Attribute &attr, const Ray &ray) const override;
 
  private:
   void cleanup();
 
   helium::IntrusivePtr<Array1D> m_index;
   helium::IntrusivePtr<Array1D> m_vertexPosition;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
+  CompactMesh m_compactMesh;
 };
 
 } // namespace helide
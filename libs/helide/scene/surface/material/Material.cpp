@@ -29,6 +29,13 @@ Material *Material::createInstance(
     return (Material *)new UnknownObject(ANARI_MATERIAL, s);
 }
 
+void Material::markCommitted()
+{
+  Object::markCommitted();
+  deviceState()->objectUpdates.lastHitRecordsRebuildRequest =
+      helium::newTimeStamp();
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Material *);
@@ -20,6 +20,8 @@ struct Material : public Object
   Attribute colorAttribute() const;
   const Sampler *colorSampler() const;
 
+  void markCommitted() override;
+
  protected:
   float3 m_color{1.f, 1.f, 1.f};
   Attribute m_colorAttribute{Attribute::NONE};
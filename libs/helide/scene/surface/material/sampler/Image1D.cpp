@@ -8,6 +8,11 @@ namespace helide {
 
 Image1D::Image1D(HelideGlobalState *s) : Sampler(s) {}
 
+Image1D::~Image1D()
+{
+  cleanup();
+}
+
 bool Image1D::isValid() const
 {
   return Sampler::isValid() && m_image;
@@ -16,7 +21,13 @@ bool Image1D::isValid() const
 void Image1D::commit()
 {
   Sampler::commit();
+  cleanup();
   m_image = getParamObject<Array1D>("image");
+  if (m_image) {
+    m_image->addCommitObserver(this);
+    m_texels = m_image->attributeAccessor();
+  } else
+    m_texels = AttributeAccessor();
   m_inAttribute =
       attributeFromString(getParamString("inAttribute", "attribute0"));
   m_linearFilter = getParamString("filter", "linear") != "nearest";
@@ -33,12 +44,23 @@ float4 Image1D::getSample(const Geometry &g, const Ray &r) const
   auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r));
 
   const auto interp = getInterpolant(av.x, m_image->size(), true);
-  const auto v0 = m_image->readAsAttributeValue(interp.lower, m_wrapMode);
-  const auto v1 = m_image->readAsAttributeValue(interp.upper, m_wrapMode);
+  const auto v0 = texel(interp.lower);
+  const auto v1 = texel(interp.upper);
   const auto retval = m_linearFilter ? linalg::lerp(v0, v1, interp.frac)
                                      : (interp.frac < 0.5f ? v0 : v1);
 
   return linalg::mul(m_outTransform, retval);
 }
 
+float4 Image1D::texel(int32_t i) const
+{
+  return m_texels(calculateWrapIndex(i, m_image->size(), m_wrapMode));
+}
+
+void Image1D::cleanup()
+{
+  if (m_image)
+    m_image->removeCommitObserver(this);
+}
+
 } // namespace helide
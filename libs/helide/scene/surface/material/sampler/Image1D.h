@@ -11,6 +11,7 @@ namespace helide {
 struct Image1D : public Sampler
 {
   Image1D(HelideGlobalState *d);
+  ~Image1D() override;
 
   bool isValid() const override;
   void commit() override;
@@ -18,12 +19,16 @@ struct Image1D : public Sampler
   float4 getSample(const Geometry &g, const Ray &r) const override;
 
  private:
+  float4 texel(int32_t i) const;
+  void cleanup();
+
   helium::IntrusivePtr<Array1D> m_image;
   Attribute m_inAttribute{Attribute::NONE};
   WrapMode m_wrapMode{WrapMode::DEFAULT};
   bool m_linearFilter{true};
   mat4 m_inTransform{mat4(linalg::identity)};
   mat4 m_outTransform{mat4(linalg::identity)};
+  AttributeAccessor m_texels;
 };
 
 } // namespace helide
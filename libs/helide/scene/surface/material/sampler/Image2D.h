@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Sampler.h"
+#include "TiledTexture.h"
 #include "array/Array2D.h"
 
 namespace helide {
@@ -11,6 +12,7 @@ namespace helide {
 struct Image2D : public Sampler
 {
   Image2D(HelideGlobalState *d);
+  ~Image2D() override;
 
   bool isValid() const override;
   void commit() override;
@@ -18,6 +20,11 @@ struct Image2D : public Sampler
   float4 getSample(const Geometry &g, const Ray &r) const override;
 
  private:
+  float levelOfDetail(const Geometry &g, const Ray &r) const;
+  float4 sampleLevel(const float4 &av, uint32_t level) const;
+  float4 texel(uint32_t level, int2 i) const;
+  void cleanup();
+
   helium::IntrusivePtr<Array2D> m_image;
   Attribute m_inAttribute{Attribute::NONE};
   WrapMode m_wrapMode1{WrapMode::DEFAULT};
@@ -25,6 +32,8 @@ struct Image2D : public Sampler
   bool m_linearFilter{true};
   mat4 m_inTransform{mat4(linalg::identity)};
   mat4 m_outTransform{mat4(linalg::identity)};
+  float m_inScale{1.f};
+  TiledTexture2D m_texture;
 };
 
 } // namespace helide
@@ -8,6 +8,11 @@ namespace helide {
 
 Image3D::Image3D(HelideGlobalState *s) : Sampler(s) {}
 
+Image3D::~Image3D()
+{
+  cleanup();
+}
+
 bool Image3D::isValid() const
 {
   return Sampler::isValid() && m_image;
@@ -16,7 +21,10 @@ bool Image3D::isValid() const
 void Image3D::commit()
 {
   Sampler::commit();
+  cleanup();
   m_image = getParamObject<Array3D>("image");
+  if (m_image)
+    m_image->addCommitObserver(this);
   m_inAttribute =
       attributeFromString(getParamString("inAttribute", "attribute0"));
   m_linearFilter = getParamString("filter", "linear") != "nearest";
@@ -25,59 +33,78 @@ void Image3D::commit()
   m_wrapMode3 = wrapModeFromString(getParamString("wrapMode3", "clampToEdge"));
   m_inTransform = getParam<mat4>("inTransform", mat4(linalg::identity));
   m_outTransform = getParam<mat4>("outTransform", mat4(linalg::identity));
+  m_inScale = std::max(length(m_inTransform[0].xyz()),
+      std::max(length(m_inTransform[1].xyz()),
+          length(m_inTransform[2].xyz())));
+
+  if (m_image) {
+    m_texture.build(m_image->data(),
+        m_image->elementType(),
+        m_image->size(),
+        getParam<bool>("mipmap", true),
+        texelStorageType(getParamString("texelFormat", "source"),
+            m_image->elementType()));
+  } else
+    m_texture = TiledTexture3D();
 }
 
 float4 Image3D::getSample(const Geometry &g, const Ray &r) const
 {
-  if (m_inAttribute == Attribute::NONE)
+  if (m_inAttribute == Attribute::NONE || m_texture.numLevels() == 0)
     return DEFAULT_ATTRIBUTE_VALUE;
 
   auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r));
 
-  const auto interp_x = getInterpolant(av.x, m_image->size().x, true);
-  const auto interp_y = getInterpolant(av.y, m_image->size().y, true);
-  const auto interp_z = getInterpolant(av.z, m_image->size().z, true);
-
-  const auto v000 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v001 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v010 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v011 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v100 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v101 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v110 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v111 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
+  const float lod = levelOfDetail(g, r);
+  float4 retval;
+  if (m_linearFilter) {
+    const auto level = uint32_t(lod);
+    const float frac = lod - level;
+    retval = sampleLevel(av, level);
+    if (frac > 0.f)
+      retval = linalg::lerp(retval, sampleLevel(av, level + 1), frac);
+  } else
+    retval = sampleLevel(av, uint32_t(lod + 0.5f));
+
+  return linalg::mul(m_outTransform, retval);
+}
+
+float Image3D::levelOfDetail(const Geometry &g, const Ray &r) const
+{
+  const auto numLevels = m_texture.numLevels();
+  if (numLevels < 2)
+    return 0.f;
+
+  const auto size = m_texture.size(0);
+  const float texels = attributeFootprint(g, m_inAttribute, r) * m_inScale
+      * std::max(size.x, std::max(size.y, size.z));
+  return texels > 1.f ? std::min(std::log2(texels), float(numLevels - 1))
+                      : 0.f;
+}
+
+float4 Image3D::sampleLevel(const float4 &av, uint32_t level) const
+{
+  const auto size = m_texture.size(level);
+  const auto interp_x = getInterpolant(av.x, size.x, true);
+  const auto interp_y = getInterpolant(av.y, size.y, true);
+  const auto interp_z = getInterpolant(av.z, size.z, true);
+
+  const auto v000 =
+      texel(level, {interp_x.lower, interp_y.lower, interp_z.lower});
+  const auto v001 =
+      texel(level, {interp_x.lower, interp_y.lower, interp_z.upper});
+  const auto v010 =
+      texel(level, {interp_x.lower, interp_y.upper, interp_z.lower});
+  const auto v011 =
+      texel(level, {interp_x.lower, interp_y.upper, interp_z.upper});
+  const auto v100 =
+      texel(level, {interp_x.upper, interp_y.lower, interp_z.lower});
+  const auto v101 =
+      texel(level, {interp_x.upper, interp_y.lower, interp_z.upper});
+  const auto v110 =
+      texel(level, {interp_x.upper, interp_y.upper, interp_z.lower});
+  const auto v111 =
+      texel(level, {interp_x.upper, interp_y.upper, interp_z.upper});
 
   const auto v00 = m_linearFilter ? linalg::lerp(v000, v001, interp_z.frac)
                                   : (interp_z.frac < 0.5f ? v000 : v001);
@@ -93,10 +120,23 @@ float4 Image3D::getSample(const Geometry &g, const Ray &r) const
   const auto v1 = m_linearFilter ? linalg::lerp(v10, v11, interp_y.frac)
                                  : (interp_y.frac < 0.5f ? v10 : v11);
 
-  const auto retval = m_linearFilter ? linalg::lerp(v0, v1, interp_x.frac)
-                                     : (interp_x.frac < 0.5f ? v0 : v1);
+  return m_linearFilter ? linalg::lerp(v0, v1, interp_x.frac)
+                        : (interp_x.frac < 0.5f ? v0 : v1);
+}
+
+float4 Image3D::texel(uint32_t level, int3 i) const
+{
+  const auto size = m_texture.size(level);
+  const auto x = calculateWrapIndex(i.x, size.x, m_wrapMode1);
+  const auto y = calculateWrapIndex(i.y, size.y, m_wrapMode2);
+  const auto z = calculateWrapIndex(i.z, size.z, m_wrapMode3);
+  return m_texture.texel(level, uint3(x, y, z));
+}
 
-  return linalg::mul(m_outTransform, retval);
+void Image3D::cleanup()
+{
+  if (m_image)
+    m_image->removeCommitObserver(this);
 }
 
 } // namespace helide
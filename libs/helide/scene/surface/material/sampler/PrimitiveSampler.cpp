@@ -8,6 +8,11 @@ namespace helide {
 
 PrimitiveSampler::PrimitiveSampler(HelideGlobalState *s) : Sampler(s) {}
 
+PrimitiveSampler::~PrimitiveSampler()
+{
+  cleanup();
+}
+
 bool PrimitiveSampler::isValid() const
 {
   return Sampler::isValid() && m_array;
@@ -16,14 +21,26 @@ bool PrimitiveSampler::isValid() const
 void PrimitiveSampler::commit()
 {
   Sampler::commit();
+  cleanup();
   m_array = getParamObject<Array1D>("array");
+  if (m_array) {
+    m_array->addCommitObserver(this);
+    m_values = m_array->attributeAccessor();
+  } else
+    m_values = AttributeAccessor();
   m_offset =
       uint32_t(getParam<uint64_t>("offset", getParam<uint32_t>("offset", 0)));
 }
 
 float4 PrimitiveSampler::getSample(const Geometry &g, const Ray &r) const
 {
-  return m_array->readAsAttributeValue(uint32_t(r.primID + m_offset));
+  return m_values(uint32_t(r.primID + m_offset));
+}
+
+void PrimitiveSampler::cleanup()
+{
+  if (m_array)
+    m_array->removeCommitObserver(this);
 }
 
 } // namespace helide
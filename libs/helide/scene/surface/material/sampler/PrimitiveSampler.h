@@ -11,6 +11,7 @@ namespace helide {
 struct PrimitiveSampler : public Sampler
 {
   PrimitiveSampler(HelideGlobalState *d);
+  ~PrimitiveSampler() override;
 
   bool isValid() const override;
   void commit() override;
@@ -18,8 +19,11 @@ struct PrimitiveSampler : public Sampler
   float4 getSample(const Geometry &g, const Ray &r) const override;
 
  private:
+  void cleanup();
+
   helium::IntrusivePtr<Array1D> m_array;
   uint32_t m_offset{0};
+  AttributeAccessor m_values;
 };
 
 } // namespace helide
@@ -8,6 +8,8 @@
 #include "Image3D.h"
 #include "PrimitiveSampler.h"
 #include "TransformSampler.h"
+// geometry
+#include "scene/surface/geometry/Geometry.h"
 
 namespace helide {
 
@@ -37,6 +39,20 @@ Sampler *Sampler::createInstance(std::string_view subtype, HelideGlobalState *s)
     return (Sampler *)new UnknownObject(ANARI_SAMPLER, s);
 }
 
+void Sampler::markCommitted()
+{
+  Object::markCommitted();
+  deviceState()->objectUpdates.lastHitRecordsRebuildRequest =
+      helium::newTimeStamp();
+}
+
+float Sampler::attributeFootprint(
+    const Geometry &g, Attribute attr, const Ray &r) const
+{
+  const float width = r.coneWidth + r.coneSpread * r.tfar;
+  return width > 0.f ? width * g.attributeDensity(attr, r) : 0.f;
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Sampler *);
@@ -16,8 +16,16 @@ struct Sampler : public Object
 
   virtual float4 getSample(const Geometry &g, const Ray &r) const = 0;
 
+  void markCommitted() override;
+
   static Sampler *createInstance(
       std::string_view subtype, HelideGlobalState *d);
+
+ protected:
+  // Width of the ray cone at the hit, in units of the given vertex attribute
+  // (0 if the geometry cannot estimate it)
+  float attributeFootprint(
+      const Geometry &g, Attribute attr, const Ray &r) const;
 };
 
 } // namespace helide
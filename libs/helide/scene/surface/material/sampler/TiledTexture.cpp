@@ -0,0 +1,133 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "TiledTexture.h"
+
+namespace helide {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+static constexpr size_t CACHE_LINE_SIZE = 64;
+
+template <int DIM>
+static linalg::vec<uint32_t, DIM> unflattenIndex(
+    size_t i, const linalg::vec<uint32_t, DIM> &size)
+{
+  linalg::vec<uint32_t, DIM> retval;
+  for (int d = 0; d < DIM; d++) {
+    retval[d] = uint32_t(i % size[d]);
+    i /= size[d];
+  }
+  return retval;
+}
+
+template <int DIM>
+static size_t numElements(const linalg::vec<uint32_t, DIM> &size)
+{
+  size_t retval = 1;
+  for (int d = 0; d < DIM; d++)
+    retval *= size[d];
+  return retval;
+}
+
+ANARIDataType texelStorageType(
+    std::string_view texelFormat, ANARIDataType sourceType)
+{
+  const auto numComponents = int(anari::componentsOf(sourceType));
+  if (numComponents < 1 || numComponents > 4)
+    return ANARI_UNKNOWN;
+  else if (texelFormat == "float32")
+    return ANARI_FLOAT32 + (numComponents - 1);
+  else if (texelFormat == "float16")
+    return ANARI_FLOAT16 + (numComponents - 1);
+  else
+    return ANARI_UNKNOWN;
+}
+
+// TiledTexture definitions ///////////////////////////////////////////////////
+
+template <int DIM>
+void TiledTexture<DIM>::build(const void *data,
+    ANARIDataType type,
+    const index_t &size,
+    bool mipmap,
+    ANARIDataType storageType)
+{
+  m_data.clear();
+  m_levels.clear();
+
+  if (storageType == ANARI_UNKNOWN)
+    storageType = type;
+
+  // Element types without a writer can't be read as attributes either
+  const bool supported =
+      attributeWriterFor(type) && attributeWriterFor(storageType);
+  const size_t numTexels = numElements(size);
+  if (!data || !supported || numTexels == 0) {
+    m_read = readDefaultAttribute;
+    return;
+  }
+
+  auto readSource = attributeReaderFor(type);
+  auto write = attributeWriterFor(storageType);
+  m_read = attributeReaderFor(storageType);
+
+  // Largest power of two tile edge so that a tile fits into a cache line
+  const size_t elementSize = anari::sizeOf(storageType);
+  m_tileBits = 0;
+  while ((elementSize << (DIM * (m_tileBits + 1))) <= CACHE_LINE_SIZE)
+    m_tileBits++;
+
+  const uint32_t tileSize = 1u << m_tileBits;
+  size_t numStoredElements = 0;
+  for (index_t s = size;; s = linalg::max(s / 2u, index_t(1))) {
+    Level l;
+    l.size = s;
+    l.tiles = (s + (tileSize - 1)) >> m_tileBits;
+    l.offset = numStoredElements;
+    numStoredElements += numElements(l.tiles) << (DIM * m_tileBits);
+    m_levels.push_back(l);
+    if (!mipmap || linalg::maxelem(s) == 1)
+      break;
+  }
+
+  m_data.resize(numStoredElements * elementSize);
+
+  // Base level, bit exact copy of the source if the type is unchanged //
+
+  const auto &base = m_levels[0];
+  const auto *src = (const uint8_t *)data;
+  for (size_t i = 0; i < numTexels; i++) {
+    const size_t dst = address(base, unflattenIndex(i, size));
+    if (storageType == type) {
+      std::memcpy(m_data.data() + dst * elementSize,
+          src + i * elementSize,
+          elementSize);
+    } else
+      write(m_data.data(), dst, readSource(data, i));
+  }
+
+  // Mip chain, each texel averages (up to) 2^DIM texels of the level above //
+
+  for (size_t li = 1; li < m_levels.size(); li++) {
+    const auto &in = m_levels[li - 1];
+    const auto &out = m_levels[li];
+    const size_t n = numElements(out.size);
+    for (size_t i = 0; i < n; i++) {
+      const index_t o = unflattenIndex(i, out.size);
+      float4 sum(0.f);
+      for (uint32_t c = 0; c < (1u << DIM); c++) {
+        index_t s;
+        for (int d = 0; d < DIM; d++)
+          s[d] = std::min(2 * o[d] + ((c >> d) & 1), in.size[d] - 1);
+        sum += m_read(m_data.data(), address(in, s));
+      }
+      write(m_data.data(), address(out, o), sum / float(1u << DIM));
+    }
+  }
+}
+
+template struct TiledTexture<2>;
+template struct TiledTexture<3>;
+
+} // namespace helide
@@ -0,0 +1,137 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "array/AttributeAccessor.h"
+// std
+#include <string_view>
+#include <vector>
+
+namespace helide {
+
+// Copy of 2D or 3D image data made when a sampler is committed. Texels are
+// grouped into tiles of roughly one cache line, laid out in Morton order
+// inside each tile, so that filtering neighborhoods touch as few cache lines
+// as possible. An optional box filtered mip chain is stored after the base
+// level. Texels keep the element type of the source array by default, in
+// which case the base level is an exact copy, or are decoded once into a
+// (linear) floating point storage type.
+template <int DIM>
+struct TiledTexture
+{
+  using index_t = linalg::vec<uint32_t, DIM>;
+
+  // Rebuild from row-major 'data', unsupported element types leave the
+  // texture empty (numLevels() == 0). 'storageType' ANARI_UNKNOWN keeps the
+  // element type of 'data'.
+  void build(const void *data,
+      ANARIDataType type,
+      const index_t &size,
+      bool mipmap,
+      ANARIDataType storageType = ANARI_UNKNOWN);
+
+  uint32_t numLevels() const;
+  const index_t &size(uint32_t level) const;
+
+  // 'i' must be inside of the level bounds
+  float4 texel(uint32_t level, const index_t &i) const;
+
+ private:
+  struct Level
+  {
+    index_t size;
+    index_t tiles;
+    size_t offset{0}; // in elements
+  };
+
+  size_t address(const Level &l, const index_t &i) const;
+
+  std::vector<uint8_t> m_data;
+  std::vector<Level> m_levels;
+  AttributeReadFcn m_read{readDefaultAttribute};
+  uint32_t m_tileBits{0};
+};
+
+using TiledTexture2D = TiledTexture<2>;
+using TiledTexture3D = TiledTexture<3>;
+
+// Storage type for the 'texelFormat' sampler parameter: "float32" or
+// "float16" with the component count of 'sourceType', anything else
+// ("source") is ANARI_UNKNOWN
+ANARIDataType texelStorageType(
+    std::string_view texelFormat, ANARIDataType sourceType);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+namespace detail {
+
+inline uint32_t spreadBits2(uint32_t x)
+{
+  x = (x | (x << 8)) & 0x00FF00FF;
+  x = (x | (x << 4)) & 0x0F0F0F0F;
+  x = (x | (x << 2)) & 0x33333333;
+  x = (x | (x << 1)) & 0x55555555;
+  return x;
+}
+
+inline uint32_t spreadBits3(uint32_t x)
+{
+  x = (x | (x << 16)) & 0x030000FF;
+  x = (x | (x << 8)) & 0x0300F00F;
+  x = (x | (x << 4)) & 0x030C30C3;
+  x = (x | (x << 2)) & 0x09249249;
+  return x;
+}
+
+inline uint32_t mortonIndex(const uint2 &i)
+{
+  return spreadBits2(i.x) | (spreadBits2(i.y) << 1);
+}
+
+inline uint32_t mortonIndex(const uint3 &i)
+{
+  return spreadBits3(i.x) | (spreadBits3(i.y) << 1) | (spreadBits3(i.z) << 2);
+}
+
+inline size_t flatIndex(const uint2 &i, const uint2 &size)
+{
+  return size_t(i.y) * size.x + i.x;
+}
+
+inline size_t flatIndex(const uint3 &i, const uint3 &size)
+{
+  return (size_t(i.z) * size.y + i.y) * size.x + i.x;
+}
+
+} // namespace detail
+
+template <int DIM>
+inline uint32_t TiledTexture<DIM>::numLevels() const
+{
+  return uint32_t(m_levels.size());
+}
+
+template <int DIM>
+inline const typename TiledTexture<DIM>::index_t &TiledTexture<DIM>::size(
+    uint32_t level) const
+{
+  return m_levels[level].size;
+}
+
+template <int DIM>
+inline float4 TiledTexture<DIM>::texel(uint32_t level, const index_t &i) const
+{
+  return m_read(m_data.data(), address(m_levels[level], i));
+}
+
+template <int DIM>
+inline size_t TiledTexture<DIM>::address(const Level &l, const index_t &i) const
+{
+  const index_t tile = i >> m_tileBits;
+  const index_t inTile = i & index_t((1u << m_tileBits) - 1);
+  return l.offset + (detail::flatIndex(tile, l.tiles) << (DIM * m_tileBits))
+      + detail::mortonIndex(inTile);
+}
+
+} // namespace helide
@@ -6,6 +6,9 @@
 #include "BaseFrame.h"
 // anari
 #include "anari/backend/LibraryImpl.h"
+// std
+#include <algorithm>
+#include <string_view>
 
 namespace helium {
 
@@ -36,6 +39,12 @@ int BaseDevice::getProperty(ANARIObject object,
     return referenceFromHandle(object).getProperty(name, type, mem, mask);
   }
 
+  if (std::string_view(name) == "elidedParameterUpdates"
+      && type == ANARI_UINT64) {
+    writeToVoidP(mem, m_state->elidedParameterUpdates.load());
+    return 1;
+  }
+
   return 0;
 }
 
@@ -49,11 +58,13 @@ void BaseDevice::setParameter(
     return;
   }
   auto &o = referenceFromHandle(object);
-  if (anari::isObject(type) && mem == nullptr)
-    o.removeParam(name);
+  const bool changed = anari::isObject(type) && mem == nullptr
+      ? o.removeParam(name)
+      : o.setParam(name, type, mem);
+  if (changed || !m_state->skipUnchangedParameters)
+    o.markUpdated();
   else
-    o.setParam(name, type, mem);
-  o.markUpdated();
+    m_state->elidedParameterUpdates++;
 }
 
 void BaseDevice::unsetParameter(ANARIObject o, const char *name)
@@ -62,8 +73,10 @@ void BaseDevice::unsetParameter(ANARIObject o, const char *name)
     deviceUnsetParameter(name);
   else {
     auto &obj = referenceFromHandle(o);
-    obj.removeParam(name);
-    obj.markUpdated();
+    if (obj.removeParam(name) || !m_state->skipUnchangedParameters)
+      obj.markUpdated();
+    else
+      m_state->elidedParameterUpdates++;
   }
 }
 
@@ -230,6 +243,12 @@ void BaseDevice::deviceCommitParameters()
       getParam<ANARIStatusCallback>("statusCallback", defaultStatusCallback());
   m_state->statusCBUserPtr = getParam<const void *>(
       "statusCallbackUserData", defaultStatusCallbackUserPtr());
+  m_state->skipUnchangedParameters =
+      getParam<bool>("skipUnchangedParameters", true);
+  m_state->statusMinSeverity = ANARIStatusSeverity(std::clamp(
+      getParam<int>("statusMinSeverity", ANARI_SEVERITY_DEBUG),
+      int(ANARI_SEVERITY_FATAL_ERROR),
+      int(ANARI_SEVERITY_DEBUG)));
 }
 
 void BaseDevice::deviceSetParameter(
@@ -5,6 +5,7 @@
 
 #include "BaseGlobalDeviceState.h"
 #include "utility/IntrusivePtr.h"
+#include "utility/MessageBuffer.h"
 #include "utility/ParameterizedObject.h"
 // anari
 #include "anari/backend/DeviceImpl.h"
@@ -110,8 +111,11 @@ template <typename... Args>
 inline void BaseDevice::reportMessage(
     ANARIStatusSeverity severity, const char *fmt, Args &&...args) const
 {
-  auto msg = string_printf(fmt, std::forward<Args>(args)...);
-  m_state->messageFunction(severity, msg, this);
+  if (!m_state->reportsSeverity(severity))
+    return;
+  MessageBuffer buffer;
+  m_state->messageFunction(
+      severity, buffer.format(fmt, std::forward<Args>(args)...), this);
 }
 
 // Helper functions ///////////////////////////////////////////////////////////
@@ -7,6 +7,8 @@
 // anari
 #include <anari/anari.h>
 // std
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -17,10 +19,32 @@ struct BaseGlobalDeviceState
   ANARIStatusCallback statusCB{nullptr};
   const void *statusCBUserPtr{nullptr};
   DeferredCommitBuffer commitBuffer;
+
+  // Setting a parameter to the value it already has does not mark the object
+  // updated (device parameter 'skipUnchangedParameters')
+  bool skipUnchangedParameters{true};
+  std::atomic<uint64_t> elidedParameterUpdates{0};
+
+  // Messages less severe than this are dropped before being formatted
+  // (device parameter 'statusMinSeverity')
+  ANARIStatusSeverity statusMinSeverity{ANARI_SEVERITY_DEBUG};
+
   std::function<void(int, const std::string &, const void *)> messageFunction;
 
+  // Whether a message of 'severity' would reach the status callback
+  bool reportsSeverity(ANARIStatusSeverity severity) const;
+
   BaseGlobalDeviceState(ANARIDevice d);
   virtual ~BaseGlobalDeviceState() = default;
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline bool BaseGlobalDeviceState::reportsSeverity(
+    ANARIStatusSeverity severity) const
+{
+  // Lower values are more severe
+  return statusCB && severity <= statusMinSeverity;
+}
+
 } // namespace helium
@@ -25,6 +25,12 @@ int commitPriority(ANARIDataType type)
     return 2;
   case ANARI_MATERIAL:
     return 1;
+  case ANARI_ARRAY:
+  case ANARI_ARRAY1D:
+  case ANARI_ARRAY2D:
+  case ANARI_ARRAY3D:
+    // Before everything reading array data, arrays may move it on commit
+    return -1;
   default:
     return 0;
   }
@@ -11,6 +11,8 @@
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <string_view>
 
 namespace helium {
 
@@ -47,6 +49,7 @@ struct AnariAny
   T *getObject() const;
 
   std::string getString() const;
+  std::string_view getStringView() const;
   void reserveString(size_t size);
   void resizeString(size_t size);
 
@@ -65,14 +68,21 @@ struct AnariAny
   template <typename T>
   T storageAs() const;
 
+  void setString(const char *str, size_t length);
+  void moveStringToHeap();
+
   void refIncObject() const;
   void refDecObject() const;
 
   constexpr static int MAX_LOCAL_STORAGE = 16 * sizeof(float);
 
+  // Strings shorter than MAX_LOCAL_STORAGE are kept null terminated in
+  // m_storage, so copying and setting them does not allocate. Longer strings
+  // (or ones which had their storage reserved) live in m_string.
   std::array<uint8_t, MAX_LOCAL_STORAGE> m_storage;
   std::string m_string;
   ANARIDataType m_type{ANARI_UNKNOWN};
+  bool m_heapString{false};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -83,21 +93,23 @@ inline AnariAny::AnariAny()
 }
 
 inline AnariAny::AnariAny(const AnariAny &copy)
+    : m_storage(copy.m_storage),
+      m_type(copy.m_type),
+      m_heapString(copy.m_heapString)
 {
-  reset();
-  std::memcpy(m_storage.data(), copy.m_storage.data(), m_storage.size());
-  m_string = copy.m_string;
-  m_type = copy.m_type;
+  if (m_heapString)
+    m_string = copy.m_string;
   refIncObject();
 }
 
 inline AnariAny::AnariAny(AnariAny &&tmp)
+    : m_storage(tmp.m_storage),
+      m_string(std::move(tmp.m_string)),
+      m_type(tmp.m_type),
+      m_heapString(tmp.m_heapString)
 {
-  reset();
-  std::memcpy(m_storage.data(), tmp.m_storage.data(), m_storage.size());
-  m_string = std::move(tmp.m_string);
-  m_type = tmp.m_type;
   tmp.m_type = ANARI_UNKNOWN;
+  tmp.m_heapString = false;
 }
 
 template <typename T>
@@ -108,7 +120,7 @@ inline AnariAny::AnariAny(T value)
       type != ANARI_UNKNOWN, "unknown type used initialize visrtx::AnariAny");
 
   if constexpr (type == ANARI_STRING)
-    m_string = value;
+    setString(value, std::strlen(value));
   else
     std::memcpy(m_storage.data(), &value, sizeof(value));
 
@@ -120,7 +132,7 @@ inline AnariAny::AnariAny(ANARIDataType type, const void *v)
 {
   m_type = type;
   if (type == ANARI_STRING)
-    m_string = (const char *)v;
+    setString((const char *)v, std::strlen((const char *)v));
   else if (type == ANARI_VOID_POINTER)
     std::memcpy(m_storage.data(), &v, anari::sizeOf(type));
   else
@@ -135,9 +147,13 @@ inline AnariAny::~AnariAny()
 
 inline AnariAny &AnariAny::operator=(const AnariAny &rhs)
 {
-  reset();
-  std::memcpy(m_storage.data(), rhs.m_storage.data(), m_storage.size());
-  m_string = rhs.m_string;
+  if (this == &rhs)
+    return *this;
+  refDecObject();
+  m_storage = rhs.m_storage;
+  if (rhs.m_heapString)
+    m_string = rhs.m_string;
+  m_heapString = rhs.m_heapString;
   m_type = rhs.m_type;
   refIncObject();
   return *this;
@@ -145,11 +161,16 @@ inline AnariAny &AnariAny::operator=(const AnariAny &rhs)
 
 inline AnariAny &AnariAny::operator=(AnariAny &&rhs)
 {
-  reset();
-  std::memcpy(m_storage.data(), rhs.m_storage.data(), m_storage.size());
-  m_string = std::move(rhs.m_string);
+  if (this == &rhs)
+    return *this;
+  refDecObject();
+  m_storage = rhs.m_storage;
+  if (rhs.m_heapString)
+    m_string = std::move(rhs.m_string);
+  m_heapString = rhs.m_heapString;
   m_type = rhs.m_type;
   rhs.m_type = ANARI_UNKNOWN;
+  rhs.m_heapString = false;
   return *this;
 }
 
@@ -168,7 +189,7 @@ inline bool AnariAny::operator==(const AnariAny &rhs) const
   if (type() == ANARI_BOOL)
     return get<bool>() == rhs.get<bool>();
   else if (type() == ANARI_STRING)
-    return m_string == rhs.m_string;
+    return getStringView() == rhs.getStringView();
   else {
     return std::equal(m_storage.data(),
         m_storage.data() + ::anari::sizeOf(type()),
@@ -202,14 +223,15 @@ inline T AnariAny::get() const
 
 inline const void *AnariAny::data() const
 {
-  return type() == ANARI_STRING ? (const void *)m_string.data()
-                                : (const void *)m_storage.data();
+  return type() == ANARI_STRING && m_heapString
+      ? (const void *)m_string.data()
+      : (const void *)m_storage.data();
 }
 
 inline void *AnariAny::data()
 {
-  return type() == ANARI_STRING ? (void *)m_string.data()
-                                : (void *)m_storage.data();
+  return type() == ANARI_STRING && m_heapString ? (void *)m_string.data()
+                                                : (void *)m_storage.data();
 }
 
 template <typename T>
@@ -253,6 +275,7 @@ inline void AnariAny::reset()
   std::fill(m_storage.begin(), m_storage.end(), 0);
   m_string.clear();
   m_type = ANARI_UNKNOWN;
+  m_heapString = false;
 }
 
 template <typename T>
@@ -266,17 +289,53 @@ inline T AnariAny::storageAs() const
 
 inline std::string AnariAny::getString() const
 {
-  return type() == ANARI_STRING ? m_string : "";
+  return std::string(getStringView());
+}
+
+inline std::string_view AnariAny::getStringView() const
+{
+  if (type() != ANARI_STRING)
+    return {};
+  return m_heapString ? std::string_view(m_string)
+                      : std::string_view((const char *)m_storage.data());
 }
 
 inline void AnariAny::reserveString(size_t size)
 {
-  m_string.reserve(size);
+  if (size >= MAX_LOCAL_STORAGE)
+    moveStringToHeap();
+  if (m_heapString)
+    m_string.reserve(size);
 }
 
 inline void AnariAny::resizeString(size_t size)
 {
-  m_string.resize(size);
+  if (size >= MAX_LOCAL_STORAGE)
+    moveStringToHeap();
+  if (m_heapString)
+    m_string.resize(size);
+  else
+    m_storage[size] = 0;
+}
+
+inline void AnariAny::setString(const char *str, size_t length)
+{
+  if (length < MAX_LOCAL_STORAGE) {
+    std::memcpy(m_storage.data(), str, length);
+    m_storage[length] = 0;
+    m_heapString = false;
+  } else {
+    m_string.assign(str, length);
+    m_heapString = true;
+  }
+}
+
+inline void AnariAny::moveStringToHeap()
+{
+  if (!m_heapString) {
+    m_string = getStringView();
+    m_heapString = true;
+  }
 }
 
 inline void AnariAny::refIncObject() const
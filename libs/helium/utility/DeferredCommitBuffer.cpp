@@ -5,9 +5,19 @@
 #include "BaseObject.h"
 // std
 #include <algorithm>
+#include <functional>
 
 namespace helium {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static bool needsCommit(BaseObject *obj)
+{
+  return obj->useCount() > 1 && obj->lastUpdated() > obj->lastCommitted();
+}
+
+// DeferredCommitBuffer definitions ///////////////////////////////////////////
+
 DeferredCommitBuffer::DeferredCommitBuffer()
 {
   m_commitBuffer.reserve(100);
@@ -21,38 +31,23 @@ DeferredCommitBuffer::~DeferredCommitBuffer()
 void DeferredCommitBuffer::addObject(BaseObject *obj)
 {
   obj->refInc(RefType::INTERNAL);
-  if (commitPriority(obj->type()) != commitPriority(ANARI_OBJECT))
-    m_needToSortCommits = true;
   m_commitBuffer.push_back(obj);
 }
 
 bool DeferredCommitBuffer::flush()
 {
-  if (m_commitBuffer.empty())
-    return false;
-
-  if (m_needToSortCommits) {
-    std::sort(m_commitBuffer.begin(),
-        m_commitBuffer.end(),
-        [](BaseObject *o1, BaseObject *o2) {
-          return commitPriority(o1->type()) < commitPriority(o2->type());
-        });
+  // Commits may add more objects, which are handled in another round
+  size_t begin = 0;
+  while (true) {
+    m_toCommit.assign(m_commitBuffer.begin() + begin, m_commitBuffer.end());
+    begin = m_commitBuffer.size();
+    if (m_toCommit.empty())
+      break;
+    commitObjects();
   }
 
-  m_needToSortCommits = false;
-
-  size_t i = 0;
-  size_t end = m_commitBuffer.size();
-  while (i != end) {
-    for (;i < end; i++) {
-      auto obj = m_commitBuffer[i];
-      if (obj->useCount() > 1 && obj->lastUpdated() > obj->lastCommitted()) {
-        obj->commit();
-        obj->markCommitted();
-      }
-    }
-    end = m_commitBuffer.size();
-  }
+  if (begin == 0)
+    return false;
 
   clear();
   m_lastFlush = newTimeStamp();
@@ -77,4 +72,25 @@ bool DeferredCommitBuffer::empty() const
   return m_commitBuffer.empty();
 }
 
-} // namespace helium
\ No newline at end of file
+void DeferredCommitBuffer::commitObjects()
+{
+  // Order by priority and remove repeated entries of the same object
+  std::sort(m_toCommit.begin(),
+      m_toCommit.end(),
+      [](BaseObject *o1, BaseObject *o2) {
+        const int p1 = commitPriority(o1->type());
+        const int p2 = commitPriority(o2->type());
+        return p1 < p2 || (p1 == p2 && std::less<BaseObject *>()(o1, o2));
+      });
+  m_toCommit.erase(
+      std::unique(m_toCommit.begin(), m_toCommit.end()), m_toCommit.end());
+
+  for (auto *obj : m_toCommit) {
+    if (needsCommit(obj)) {
+      obj->commit();
+      obj->markCommitted();
+    }
+  }
+}
+
+} // namespace helium
@@ -17,10 +17,11 @@ struct DeferredCommitBuffer
   ~DeferredCommitBuffer();
 
   // Add an object to this buffer. Object ref counts are incremented by 1 while
-  // objects are in this buffer.
+  // objects are in this buffer. This may be called from within commit().
   void addObject(BaseObject *obj);
 
-  // Sort objects by priority and call BaseObject::commit() on each object
+  // Sort objects by priority and call BaseObject::commit() once on each
+  // object
   bool flush();
 
   // Return when this buffer was last flushed
@@ -33,9 +34,11 @@ struct DeferredCommitBuffer
   bool empty() const;
 
  private:
+  void commitObjects();
+
   std::vector<BaseObject *> m_commitBuffer;
-  bool m_needToSortCommits{false};
+  std::vector<BaseObject *> m_toCommit;
   TimeStamp m_lastFlush{0};
 };
 
-} // namespace helium
\ No newline at end of file
+} // namespace helium
@@ -0,0 +1,151 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "FileMapping.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+// std
+#include <cerrno>
+#include <cstring>
+
+namespace helium {
+
+// Whole mapping, 'offset' of mapFile() is usually not aligned to its start
+struct MappedRegion
+{
+  void *base{nullptr};
+  size_t length{0};
+};
+
+// Written so 'offset + numBytes' can't wrap around
+static bool fitsInFile(uint64_t fileSize, uint64_t offset, uint64_t numBytes)
+{
+  return offset <= fileSize && numBytes <= fileSize - offset;
+}
+
+#ifdef _WIN32
+
+void *mapFile(const char *path,
+    uint64_t offset,
+    size_t numBytes,
+    const void **deleterPtr,
+    std::string &error)
+{
+  HANDLE file = CreateFileA(path,
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    error = "unable to open file";
+    return nullptr;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize)
+      || !fitsInFile(uint64_t(fileSize.QuadPart), offset, numBytes)) {
+    CloseHandle(file);
+    error = "file is smaller than offset + array size";
+    return nullptr;
+  }
+
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping) {
+    error = "unable to create file mapping";
+    return nullptr;
+  }
+
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  const uint64_t start = offset - offset % info.dwAllocationGranularity;
+  const size_t length = size_t(offset - start) + numBytes;
+
+  void *base = MapViewOfFile(mapping,
+      FILE_MAP_COPY,
+      DWORD(start >> 32),
+      DWORD(start & 0xFFFFFFFF),
+      length);
+  CloseHandle(mapping);
+  if (!base) {
+    error = "unable to map view of file";
+    return nullptr;
+  }
+
+  *deleterPtr = new MappedRegion{base, length};
+  return (char *)base + (offset - start);
+}
+
+void unmapFile(const void *deleterPtr, const void *)
+{
+  auto *region = (const MappedRegion *)deleterPtr;
+  UnmapViewOfFile(region->base);
+  delete region;
+}
+
+#else
+
+void *mapFile(const char *path,
+    uint64_t offset,
+    size_t numBytes,
+    const void **deleterPtr,
+    std::string &error)
+{
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    error = std::strerror(errno);
+    return nullptr;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0
+      || !fitsInFile(uint64_t(st.st_size), offset, numBytes)) {
+    close(fd);
+    error = "file is smaller than offset + array size";
+    return nullptr;
+  }
+
+  const uint64_t pageSize = sysconf(_SC_PAGESIZE);
+  const uint64_t start = offset - offset % pageSize;
+  const size_t length = size_t(offset - start) + numBytes;
+
+  // The mapping keeps its own reference to the file
+  void *base =
+      mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, start);
+  close(fd);
+  if (base == MAP_FAILED) {
+    error = std::strerror(errno);
+    return nullptr;
+  }
+
+  // Arrays are read front to back when objects using them are committed
+  madvise(base, length, MADV_SEQUENTIAL);
+  madvise(base, length, MADV_WILLNEED);
+
+  *deleterPtr = new MappedRegion{base, length};
+  return (char *)base + (offset - start);
+}
+
+void unmapFile(const void *deleterPtr, const void *)
+{
+  auto *region = (const MappedRegion *)deleterPtr;
+  munmap(region->base, region->length);
+  delete region;
+}
+
+#endif
+
+} // namespace helium
@@ -0,0 +1,29 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+
+namespace helium {
+
+// Maps 'numBytes' of the file at 'path', starting at byte 'offset', into
+// memory. Pages are copy-on-write: they are shared with the page cache (and
+// other processes mapping the same file) until written to, and writes never
+// reach the file. Reading ahead is requested from the OS right away.
+//
+// On success the returned memory must be released by calling
+// unmapFile(*deleterPtr, memory), for example by using it as captured array
+// memory. On failure nullptr is returned and 'error' says why.
+void *mapFile(const char *path,
+    uint64_t offset,
+    size_t numBytes,
+    const void **deleterPtr,
+    std::string &error);
+
+// ANARIMemoryDeleter for memory returned by mapFile()
+void unmapFile(const void *deleterPtr, const void *memory);
+
+} // namespace helium
@@ -0,0 +1,177 @@
+// Copyright 2021 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated by generate_param_names.py
+// Don't make changes to this directly
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace helium {
+namespace known_param_names {
+
+static const uint32_t count = 127;
+
+static const char *names[] = {
+   "accumulation",
+   "alphaCutoff",
+   "alphaMode",
+   "ambientColor",
+   "ambientRadiance",
+   "angularDiameter",
+   "apertureRadius",
+   "array",
+   "aspect",
+   "attenuationColor",
+   "attenuationDistance",
+   "background",
+   "baseColor",
+   "c0",
+   "camera",
+   "caps",
+   "channel.albedo",
+   "channel.color",
+   "channel.depth",
+   "channel.normal",
+   "clearcoat",
+   "clearcoatNormal",
+   "clearcoatRoughness",
+   "color",
+   "color.position",
+   "data",
+   "densityScale",
+   "direction",
+   "edge1",
+   "edge2",
+   "emissive",
+   "falloffAngle",
+   "far",
+   "field",
+   "filter",
+   "focusDistance",
+   "fovy",
+   "frameCompletionCallback",
+   "frameCompletionCallbackUserData",
+   "geometry",
+   "group",
+   "height",
+   "image",
+   "imageRegion",
+   "inAttribute",
+   "inOffset",
+   "inTransform",
+   "innerRadius",
+   "instance",
+   "intensity",
+   "intensityDistribution",
+   "interpupillaryDistance",
+   "ior",
+   "iridescence",
+   "iridescenceIor",
+   "iridescenceThickness",
+   "irradiance",
+   "layout",
+   "light",
+   "material",
+   "metallic",
+   "motion.rotation",
+   "motion.scale",
+   "motion.transform",
+   "motion.translation",
+   "name",
+   "near",
+   "normal",
+   "occlusion",
+   "opacity",
+   "opacity.position",
+   "openingAngle",
+   "origin",
+   "outOffset",
+   "outTransform",
+   "position",
+   "power",
+   "primitive.attribute0",
+   "primitive.attribute1",
+   "primitive.attribute2",
+   "primitive.attribute3",
+   "primitive.color",
+   "primitive.id",
+   "primitive.index",
+   "primitive.radius",
+   "radiance",
+   "radius",
+   "region",
+   "renderer",
+   "roughness",
+   "scale",
+   "sheenColor",
+   "sheenRoughness",
+   "shutter",
+   "side",
+   "size",
+   "spacing",
+   "specular",
+   "specularColor",
+   "statusCallback",
+   "statusCallbackUserData",
+   "stereoMode",
+   "surface",
+   "thickness",
+   "time",
+   "transform",
+   "transmission",
+   "up",
+   "valueRange",
+   "variance",
+   "vertex.attribute0",
+   "vertex.attribute1",
+   "vertex.attribute2",
+   "vertex.attribute3",
+   "vertex.cap",
+   "vertex.color",
+   "vertex.normal",
+   "vertex.position",
+   "vertex.radius",
+   "vertex.tangent",
+   "visible",
+   "volume",
+   "volumeSampleRateFactor",
+   "world",
+   "wrapMode1",
+   "wrapMode2",
+   "wrapMode3"
+};
+
+static int hash(const char *str, size_t len) {
+   static const char *keywords[] = {"accumulation","alphaCutoff","alphaMode","ambientColor","ambientRadiance","angularDiameter","apertureRadius","array","aspect","attenuationColor","attenuationDistance","background","baseColor","c0","camera","caps","channel.albedo","channel.color","channel.depth","channel.normal","clearcoat","clearcoatNormal","clearcoatRoughness","color","color.position","data","densityScale","direction","edge1","edge2","emissive","falloffAngle","far","field","filter","focusDistance","fovy","frameCompletionCallback","frameCompletionCallbackUserData","geometry","group","height","image","imageRegion","inAttribute","inOffset","inTransform","innerRadius","instance","intensity","intensityDistribution","interpupillaryDistance","ior","iridescence","iridescenceIor","iridescenceThickness","irradiance","layout","light","material","metallic","motion.rotation","motion.scale","motion.transform","motion.translation","name","near","normal","occlusion","opacity","opacity.position","openingAngle","origin","outOffset","outTransform","position","power","primitive.attribute0","primitive.attribute1","primitive.attribute2","primitive.attribute3","primitive.color","primitive.id","primitive.index","primitive.radius","radiance","radius","region","renderer","roughness","scale","sheenColor","sheenRoughness","shutter","side","size","spacing","specular","specularColor","statusCallback","statusCallbackUserData","stereoMode","surface","thickness","time","transform","transmission","up","valueRange","variance","vertex.attribute0","vertex.attribute1","vertex.attribute2","vertex.attribute3","vertex.cap","vertex.color","vertex.normal","vertex.position","vertex.radius","vertex.tangent","visible","volume","volumeSampleRateFactor","world","wrapMode1","wrapMode2","wrapMode3"};
+   static const uint32_t lengths[] = {12,11,9,12,15,15,14,5,6,16,19,10,9,2,6,4,14,13,13,14,9,15,18,5,14,4,12,9,5,5,8,12,3,5,6,13,4,23,31,8,5,6,5,11,11,8,11,11,8,9,21,22,3,11,14,20,10,6,5,8,8,15,12,16,18,4,4,6,9,7,16,12,6,9,12,8,5,20,20,20,20,15,12,15,16,8,6,6,8,9,5,10,14,7,4,4,7,8,13,14,22,10,7,9,4,9,12,2,10,8,17,17,17,17,10,12,13,15,13,14,7,6,22,5,9,9,9};
+   static const int32_t values[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126};
+   static const int32_t table[] = {-1,-1,-1,-1,-1,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,65,56,-1,-1,-1,-1,-1,18,-1,-1,-1,-1,16,-1,-1,-1,125,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,75,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,86,15,-1,-1,-1,-1,-1,38,-1,-1,-1,-1,-1,-1,-1,-1,111,-1,-1,-1,-1,80,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,117,-1,-1,-1,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,76,-1,-1,-1,120,123,-1,-1,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,44,-1,-1,-1,-1,46,-1,-1,-1,-1,-1,119,-1,-1,66,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,99,-1,-1,-1,55,-1,-1,-1,-1,-1,-1,-1,-1,5,-1,-1,-1,-1,-1,72,-1,-1,92,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,33,1,-1,-1,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,104,-1,-1,-1,-1,-1,84,-1,-1,-1,-1,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,41,-1,-1,0,-1,-1,-1,32,-1,-1,-1,98,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,107,8,105,-1,-1,-1,-1,-1,-1,-1,-1,-1,124,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,81,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,19,-1,-1,-1,6,-1,-1,-1,-1,-1,-1,-1,-1,54,-1,-1,79,101,-1,-1,-1,71,-1,-1,-1,64,-1,-1,-1,106,-1,-1,-1,57,-1,-1,-1,-1,39,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,109,-1,-1,7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,42,-1,-1,-1,-1,-1,-1,-1,-1,96,-1,-1,-1,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,89,-1,-1,-1,108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,114,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,85,-1,-1,-1,-1,-1,88,-1,-1,20,97,-1,-1,-1,-1,-1,-1,24,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,67,-1,-1,-1,-1,-1,-1,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,31,87,-1,-1,-1,-1,-1,47,-1,-1,-1,-1,103,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,45,-1,-1,-1,-1,-1,-1,61,-1,83,-1,-1,-1,-1,-1,43,-1,-1,-1,-1,53,-1,50,-1,68,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,95,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,23,-1,-1,-1,82,-1,-1,91,-1,-1,-1,-1,-1,-1,-1,-1,28,-1,70,-1,62,-1,-1,-1,122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,40,21,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,60,-1,-1,-1,-1,69,-1,-1,-1,-1,-1,-1,-1,-1,-1,10,-1,-1,11,17,48,-1,-1,110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,126,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,94,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,93,118,14,-1,-1,-1,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,59,121,-1,-1,-1,102,-1,-1,-1,-1,52,-1,-1,-1,-1,36,-1,-1,-1,-1,-1,-1,4,-1,-1,115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,74,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,113,-1,-1,-1,-1,-1,-1,-1,-1,78,-1,49,-1,51,-1,-1,29,-1,-1,2,-1,-1,77,-1,-1,58,-1,-1,-1,-1,-1};
+   uint64_t h = 0xa47ull^(len*0x9e3779b97f4a7c15ull);
+   size_t i = 0;
+   for(;i+8<=len;i+=8) {
+      uint64_t w;
+      memcpy(&w, str+i, 8);
+      h = (h^w)*0xff51afd7ed558ccdull;
+      h ^= h>>32u;
+   }
+   if(i<len) {
+      uint64_t w = 0;
+      for(size_t j = 0;i+j<len;j++) {
+         w |= uint64_t((unsigned char)str[i+j])<<(8u*j);
+      }
+      h = (h^w)*0xff51afd7ed558ccdull;
+      h ^= h>>32u;
+   }
+   int32_t k = table[(h*0x9e3779b97f4a7c15ull)>>54u];
+   if(k<0 || lengths[k]!=len || memcmp(keywords[k], str, len)!=0) {
+      return -1;
+   }
+   return values[k];
+}
+
+} // namespace known_param_names
+} // namespace helium
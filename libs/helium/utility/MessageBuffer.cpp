@@ -0,0 +1,65 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "MessageBuffer.h"
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <deque>
+
+namespace helium {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Strings of the calling thread, one per nesting level of MessageBuffers. A
+// deque keeps references to outer strings valid when a level is added.
+struct ThreadMessageStrings
+{
+  std::deque<std::string> strings;
+  size_t inUse{0};
+};
+
+static ThreadMessageStrings &threadMessageStrings()
+{
+  thread_local ThreadMessageStrings strings;
+  return strings;
+}
+
+// MessageBuffer definitions //////////////////////////////////////////////////
+
+MessageBuffer::MessageBuffer()
+{
+  auto &t = threadMessageStrings();
+  if (t.inUse == t.strings.size())
+    t.strings.emplace_back();
+  m_string = &t.strings[t.inUse++];
+}
+
+MessageBuffer::~MessageBuffer()
+{
+  threadMessageStrings().inUse--;
+}
+
+const std::string &MessageBuffer::format(const char *fmt, ...)
+{
+  auto &s = *m_string;
+  va_list args, args2;
+  va_start(args, fmt);
+  va_copy(args2, args);
+
+  // Try the current capacity first, only grow for longer messages
+  s.resize(s.capacity());
+  const int length = vsnprintf(s.data(), s.size() + 1, fmt, args2);
+  va_end(args2);
+  if (length < 0)
+    s.clear();
+  else if (size_t(length) > s.size()) {
+    s.resize(length);
+    vsnprintf(s.data(), s.size() + 1, fmt, args);
+  } else
+    s.resize(length);
+  va_end(args);
+  return s;
+}
+
+} // namespace helium
@@ -0,0 +1,31 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <string>
+
+namespace helium {
+
+// Formats status messages into strings owned by the calling thread, which
+// are reused by later messages instead of allocating. Each live MessageBuffer
+// on a thread holds its own string, so a status callback reporting another
+// message while one is being reported does not overwrite the outer one.
+struct MessageBuffer
+{
+  MessageBuffer();
+  ~MessageBuffer();
+
+  MessageBuffer(const MessageBuffer &) = delete;
+  MessageBuffer &operator=(const MessageBuffer &) = delete;
+
+  // printf() style formatting, valid until this buffer is destroyed or used
+  // again
+  const std::string &format(const char *fmt, ...);
+
+ private:
+  std::string *m_string{nullptr};
+};
+
+} // namespace helium
@@ -0,0 +1,72 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ParamName.h"
+#include "KnownParamNames.h"
+// std
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace helium {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Names which are not known at compile time, ids start after the known ones
+struct NameTable
+{
+  std::shared_mutex mutex;
+  std::deque<std::string> names; // stable storage for the map keys
+  std::unordered_map<std::string_view, uint32_t> ids;
+};
+
+static NameTable &nameTable()
+{
+  static NameTable table;
+  return table;
+}
+
+static uint32_t internUnknownName(std::string_view name)
+{
+  auto &table = nameTable();
+
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    auto it = table.ids.find(name);
+    if (it != table.ids.end())
+      return it->second;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(table.mutex);
+  auto it = table.ids.find(name);
+  if (it != table.ids.end())
+    return it->second;
+
+  const uint32_t id = known_param_names::count + uint32_t(table.names.size());
+  table.names.emplace_back(name);
+  table.ids.emplace(table.names.back(), id);
+  return id;
+}
+
+// ParamName definitions //////////////////////////////////////////////////////
+
+ParamName::ParamName(std::string_view name)
+{
+  const int known = known_param_names::hash(name.data(), name.size());
+  m_id = known >= 0 ? uint32_t(known) : internUnknownName(name);
+}
+
+std::string_view ParamName::str() const
+{
+  if (m_id < known_param_names::count)
+    return known_param_names::names[m_id];
+  else if (m_id == ~0u)
+    return {};
+
+  auto &table = nameTable();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return table.names[m_id - known_param_names::count];
+}
+
+} // namespace helium
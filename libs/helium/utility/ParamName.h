@@ -0,0 +1,61 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace helium {
+
+// Interned parameter name: comparing or storing one is an integer operation.
+// Names defined by the ANARI API (core and KHR extensions) map to fixed ids
+// through a generated perfect hash, any other name is added to a global table
+// the first time it is seen. Constructing a ParamName from a string therefore
+// costs a lookup, code which queries the same name repeatedly can keep the
+// ParamName around instead.
+struct ParamName
+{
+  ParamName() = default;
+  ParamName(const char *name);
+  ParamName(const std::string &name);
+  ParamName(std::string_view name);
+
+  uint32_t id() const;
+  std::string_view str() const;
+
+  bool operator==(const ParamName &o) const;
+  bool operator!=(const ParamName &o) const;
+
+ private:
+  uint32_t m_id{~0u};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline ParamName::ParamName(const char *name)
+    : ParamName(std::string_view(name))
+{}
+
+inline ParamName::ParamName(const std::string &name)
+    : ParamName(std::string_view(name))
+{}
+
+inline uint32_t ParamName::id() const
+{
+  return m_id;
+}
+
+inline bool ParamName::operator==(const ParamName &o) const
+{
+  return m_id == o.m_id;
+}
+
+inline bool ParamName::operator!=(const ParamName &o) const
+{
+  return m_id != o.m_id;
+}
+
+} // namespace helium
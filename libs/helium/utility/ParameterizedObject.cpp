@@ -7,19 +7,23 @@
 
 namespace helium {
 
-bool ParameterizedObject::hasParam(const std::string &name)
+bool ParameterizedObject::hasParam(ParamName name)
 {
   return findParam(name, false) != nullptr;
 }
 
-void ParameterizedObject::setParam(
-    const std::string &name, ANARIDataType type, const void *v)
+bool ParameterizedObject::setParam(
+    ParamName name, ANARIDataType type, const void *v)
 {
-  findParam(name, true)->second = AnariAny(type, v);
+  AnariAny value(type, v);
+  auto *p = findParam(name, true);
+  if (p->second == value)
+    return false;
+  p->second = std::move(value);
+  return true;
 }
 
-bool ParameterizedObject::getParam(
-    const std::string &name, ANARIDataType type, void *v)
+bool ParameterizedObject::getParam(ParamName name, ANARIDataType type, void *v)
 {
   if (type == ANARI_STRING || anari::isObject(type))
     return false;
@@ -33,32 +37,39 @@ bool ParameterizedObject::getParam(
 }
 
 std::string ParameterizedObject::getParamString(
-    const std::string &name, const std::string &valIfNotFound)
+    ParamName name, const std::string &valIfNotFound)
 {
   auto *p = findParam(name);
   return p ? p->second.getString() : valIfNotFound;
 }
 
-AnariAny ParameterizedObject::getParamDirect(const std::string &name)
+AnariAny ParameterizedObject::getParamDirect(ParamName name)
 {
   auto *p = findParam(name);
   return p ? p->second : AnariAny();
 }
 
-void ParameterizedObject::setParamDirect(
-    const std::string &name, const AnariAny &v)
+void ParameterizedObject::setParamDirect(ParamName name, const AnariAny &v)
 {
   findParam(name, true)->second = v;
 }
 
-void ParameterizedObject::removeParam(const std::string &name)
+void ParameterizedObject::setParamDirect(ParamName name, AnariAny &&v)
+{
+  findParam(name, true)->second = std::move(v);
+}
+
+bool ParameterizedObject::removeParam(ParamName name)
 {
   auto foundParam = std::find_if(m_params.begin(),
       m_params.end(),
       [&](const Param &p) { return p.first == name; });
 
-  if (foundParam != m_params.end())
-    m_params.erase(foundParam);
+  if (foundParam == m_params.end())
+    return false;
+
+  m_params.erase(foundParam);
+  return true;
 }
 
 ParameterizedObject::ParameterList::iterator ParameterizedObject::params_begin()
@@ -72,7 +83,7 @@ ParameterizedObject::ParameterList::iterator ParameterizedObject::params_end()
 }
 
 ParameterizedObject::Param *ParameterizedObject::findParam(
-    const std::string &name, bool addIfNotExist)
+    ParamName name, bool addIfNotExist)
 {
   auto foundParam = std::find_if(m_params.begin(),
       m_params.end(),
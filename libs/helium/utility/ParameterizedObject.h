@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AnariAny.h"
+#include "ParamName.h"
 // anari
 #include "anari/anari_cpp/Traits.h"
 // stl
@@ -14,20 +15,24 @@
 
 namespace helium {
 
+// Parameters are kept in a small flat list keyed by interned ParamName, so
+// lookups compare integers instead of strings. All methods taking a name
+// accept a string (literal, std::string, std::string_view) or a ParamName.
 struct ParameterizedObject
 {
   ParameterizedObject() = default;
   virtual ~ParameterizedObject() = default;
 
   // Return true if there was a parameter set with the corresponding 'name'
-  bool hasParam(const std::string &name);
+  bool hasParam(ParamName name);
 
-  // Set the value of the parameter 'name', or add it if it doesn't exist yet
-  void setParam(const std::string &name, ANARIDataType type, const void *v);
+  // Set the value of the parameter 'name', or add it if it doesn't exist yet.
+  // Returns false if the parameter already held an identical value.
+  bool setParam(ParamName name, ANARIDataType type, const void *v);
 
   // Set the value of the parameter 'name', or add it if it doesn't exist yet
   template <typename T>
-  void setParam(const std::string &name, const T &v);
+  void setParam(ParamName name, const T &v);
 
   // Get the value of the parameter associated with 'name', or return
   // 'valueIfNotFound' if the parameter isn't set. This is strongly typed by
@@ -37,13 +42,13 @@ struct ParameterizedObject
   // access ANARIObject or ANARIString parameters, see special methods for
   // getting parameters of those types.
   template <typename T>
-  T getParam(const std::string &name, T valIfNotFound);
+  T getParam(ParamName name, T valIfNotFound);
 
   // Get the value of the parameter associated with 'name' and write it to
   // location 'v', returning whether the was actually read. Just like the
   // templated version above, this requires that 'type' exactly match what the
   // application set. This function also cannot get objects or strings.
-  bool getParam(const std::string &name, ANARIDataType type, void *v);
+  bool getParam(ParamName name, ANARIDataType type, void *v);
 
   // Get the pointer to an object parameter (returns null if not present). While
   // ParameterizedObject will track object lifetime appropriately, accessing
@@ -51,24 +56,26 @@ struct ParameterizedObject
   // should consider using `helium::IntrusivePtr<>` to guarantee correct
   // lifetime handling.
   template <typename T>
-  T *getParamObject(const std::string &name);
+  T *getParamObject(ParamName name);
 
   // Get a string parameter value
-  std::string getParamString(
-      const std::string &name, const std::string &valIfNotFound);
+  std::string getParamString(ParamName name, const std::string &valIfNotFound);
 
   // Get/Set the container holding the value of a parameter (default constructed
   // AnariAny if not present). Getting this container will create a copy of the
   // parameter value, which for objects will incur the correct ref count changes
-  // accordingly (handled by AnariAny).
-  AnariAny getParamDirect(const std::string &name);
-  void setParamDirect(const std::string &name, const AnariAny &v);
+  // accordingly (handled by AnariAny). Passing a temporary to setParamDirect()
+  // moves it into place instead.
+  AnariAny getParamDirect(ParamName name);
+  void setParamDirect(ParamName name, const AnariAny &v);
+  void setParamDirect(ParamName name, AnariAny &&v);
 
-  // Remove the value of the parameter associated with 'name'.
-  void removeParam(const std::string &name);
+  // Remove the value of the parameter associated with 'name', returns whether
+  // it was actually set.
+  bool removeParam(ParamName name);
 
  protected:
-  using Param = std::pair<std::string, AnariAny>;
+  using Param = std::pair<ParamName, AnariAny>;
   using ParameterList = std::vector<Param>;
 
   ParameterList::iterator params_begin();
@@ -77,7 +84,7 @@ struct ParameterizedObject
  private:
   // Data members //
 
-  Param *findParam(const std::string &name, bool addIfNotExist = false);
+  Param *findParam(ParamName name, bool addIfNotExist = false);
 
   ParameterList m_params;
 };
@@ -85,21 +92,20 @@ struct ParameterizedObject
 // Inlined ParameterizedObject definitions ////////////////////////////////////
 
 template <typename T>
-inline void ParameterizedObject::setParam(const std::string &name, const T &v)
+inline void ParameterizedObject::setParam(ParamName name, const T &v)
 {
   constexpr ANARIDataType type = anari::ANARITypeFor<T>::value;
   setParam(name, type, &v);
 }
 
 template <>
-inline void ParameterizedObject::setParam(
-    const std::string &name, const std::string &v)
+inline void ParameterizedObject::setParam(ParamName name, const std::string &v)
 {
   setParam(name, ANARI_STRING, v.c_str());
 }
 
 template <typename T>
-inline T ParameterizedObject::getParam(const std::string &name, T valIfNotFound)
+inline T ParameterizedObject::getParam(ParamName name, T valIfNotFound)
 {
   constexpr ANARIDataType type = anari::ANARITypeFor<T>::value;
   static_assert(!anari::isObject(type),
@@ -111,7 +117,7 @@ inline T ParameterizedObject::getParam(const std::string &name, T valIfNotFound)
 }
 
 template <typename T>
-inline T *ParameterizedObject::getParamObject(const std::string &name)
+inline T *ParameterizedObject::getParamObject(ParamName name)
 {
   auto *p = findParam(name);
   return p ? p->second.getObject<T>() : nullptr;
@@ -0,0 +1,88 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SlabAllocator.h"
+// std
+#include <new>
+
+namespace helium {
+
+SlabAllocator::~SlabAllocator()
+{
+  for (void *slab : m_slabs)
+    ::operator delete(slab);
+}
+
+void *SlabAllocator::allocate(size_t numBytes)
+{
+  if (numBytes == 0 || numBytes > MAX_BLOCK_SIZE) {
+    m_bytesInUse += numBytes;
+    m_bytesReserved += numBytes;
+    return ::operator new(numBytes);
+  }
+
+  const size_t index = classIndex(numBytes);
+  const size_t blockSize = (index + 1) * BLOCK_ALIGNMENT;
+  m_bytesInUse += blockSize;
+
+  auto &sc = m_classes[index];
+  std::lock_guard<std::mutex> lock(sc.mutex);
+
+  if (sc.freeList) {
+    auto *block = sc.freeList;
+    sc.freeList = block->next;
+    return block;
+  }
+
+  if (sc.cursor + blockSize > sc.end) {
+    auto *slab = (char *)::operator new(SLAB_SIZE);
+    {
+      std::lock_guard<std::mutex> slabLock(m_slabMutex);
+      m_slabs.push_back(slab);
+    }
+    m_bytesReserved += SLAB_SIZE;
+    sc.cursor = slab;
+    sc.end = slab + SLAB_SIZE;
+  }
+
+  void *block = sc.cursor;
+  sc.cursor += blockSize;
+  return block;
+}
+
+void SlabAllocator::free(void *mem, size_t numBytes)
+{
+  if (!mem)
+    return;
+
+  if (numBytes == 0 || numBytes > MAX_BLOCK_SIZE) {
+    m_bytesInUse -= numBytes;
+    m_bytesReserved -= numBytes;
+    ::operator delete(mem);
+    return;
+  }
+
+  const size_t index = classIndex(numBytes);
+  m_bytesInUse -= (index + 1) * BLOCK_ALIGNMENT;
+
+  auto &sc = m_classes[index];
+  std::lock_guard<std::mutex> lock(sc.mutex);
+  sc.freeList = new (mem) FreeBlock{sc.freeList};
+}
+
+size_t SlabAllocator::bytesInUse() const
+{
+  return m_bytesInUse;
+}
+
+size_t SlabAllocator::bytesReserved() const
+{
+  return m_bytesReserved;
+}
+
+size_t SlabAllocator::classIndex(size_t numBytes)
+{
+  return (numBytes - 1) / BLOCK_ALIGNMENT;
+}
+
+} // namespace helium
@@ -0,0 +1,67 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace helium {
+
+// Allocator for many small, long lived objects of few different sizes (scene
+// objects). Sizes are rounded up to 16 byte classes, each class carves blocks
+// out of 64 KiB slabs and keeps a free list of released blocks which later
+// allocations of that class reuse. Slabs are only returned to the system when
+// the allocator is destroyed. Sizes above MAX_BLOCK_SIZE go to the global
+// operator new. All methods are thread safe.
+struct SlabAllocator
+{
+  static constexpr size_t BLOCK_ALIGNMENT = 16;
+  static constexpr size_t MAX_BLOCK_SIZE = 2048;
+  static constexpr size_t SLAB_SIZE = 64 * 1024;
+
+  SlabAllocator() = default;
+  ~SlabAllocator();
+
+  SlabAllocator(const SlabAllocator &) = delete;
+  SlabAllocator &operator=(const SlabAllocator &) = delete;
+
+  void *allocate(size_t numBytes);
+  // 'numBytes' must be the size passed to allocate()
+  void free(void *mem, size_t numBytes);
+
+  // Bytes of all live allocations (rounded up to their class size)
+  size_t bytesInUse() const;
+  // Bytes taken from the system: slabs plus allocations above MAX_BLOCK_SIZE
+  size_t bytesReserved() const;
+
+ private:
+  struct FreeBlock
+  {
+    FreeBlock *next{nullptr};
+  };
+
+  struct SizeClass
+  {
+    std::mutex mutex;
+    FreeBlock *freeList{nullptr};
+    char *cursor{nullptr};
+    char *end{nullptr};
+  };
+
+  static size_t classIndex(size_t numBytes);
+
+  std::array<SizeClass, MAX_BLOCK_SIZE / BLOCK_ALIGNMENT> m_classes;
+
+  std::mutex m_slabMutex;
+  std::vector<void *> m_slabs;
+
+  std::atomic<size_t> m_bytesInUse{0};
+  std::atomic<size_t> m_bytesReserved{0};
+};
+
+} // namespace helium
@@ -2,4 +2,5 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include "catch.hpp"
@@ -0,0 +1,121 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/BaseObject.h"
+// std
+#include <functional>
+#include <vector>
+
+namespace {
+
+using helium::BaseObject;
+
+static int g_commitSequence = 0;
+
+struct TestObject : public BaseObject
+{
+  TestObject(ANARIDataType type, helium::BaseGlobalDeviceState *s)
+      : BaseObject(type, s)
+  {}
+
+  bool getProperty(const std::string_view &, ANARIDataType, void *, uint32_t)
+      override
+  {
+    return false;
+  }
+
+  void commit() override
+  {
+    commits++;
+    sequence = g_commitSequence++;
+    if (onCommit)
+      onCommit();
+  }
+
+  int commits{0};
+  int sequence{-1};
+  std::function<void()> onCommit;
+};
+
+struct TestScene
+{
+  helium::BaseGlobalDeviceState state{nullptr};
+  std::vector<TestObject *> objects;
+
+  ~TestScene()
+  {
+    state.commitBuffer.clear();
+    for (auto *o : objects)
+      o->refDec(helium::RefType::PUBLIC);
+  }
+
+  TestObject *add(ANARIDataType type)
+  {
+    auto *o = new TestObject(type, &state);
+    objects.push_back(o);
+    return o;
+  }
+
+  void commit(TestObject *o)
+  {
+    o->markUpdated();
+    state.commitBuffer.addObject(o);
+  }
+};
+
+SCENARIO(
+    "helium::DeferredCommitBuffer flushing", "[helium_DeferredCommitBuffer]")
+{
+  GIVEN("A buffer with objects of several priorities")
+  {
+    TestScene scene;
+
+    std::vector<TestObject *> geometries;
+    for (int i = 0; i < 8; i++)
+      geometries.push_back(scene.add(ANARI_GEOMETRY));
+    auto *surface = scene.add(ANARI_SURFACE);
+    auto *group = scene.add(ANARI_GROUP);
+    auto *array = scene.add(ANARI_ARRAY1D);
+
+    // Committing the group changes a geometry which wasn't committed yet
+    auto *lateGeometry = scene.add(ANARI_GEOMETRY);
+    group->onCommit = [&]() { scene.commit(lateGeometry); };
+
+    // Objects are added in reverse priority order, some repeatedly
+    scene.commit(group);
+    scene.commit(surface);
+    scene.commit(surface);
+    for (auto *g : geometries)
+      scene.commit(g);
+    scene.commit(geometries[0]);
+    scene.commit(array);
+
+    REQUIRE(scene.state.commitBuffer.flush());
+
+    THEN("Each object is committed once")
+    {
+      for (auto *o : scene.objects)
+        REQUIRE(o->commits == 1);
+    }
+
+    THEN("Objects added during the flush are committed afterwards")
+    {
+      REQUIRE(lateGeometry->commits == 1);
+      REQUIRE(lateGeometry->sequence > group->sequence);
+      REQUIRE(scene.state.commitBuffer.empty());
+    }
+
+    THEN("Priority levels are committed in order")
+    {
+      for (auto *g : geometries) {
+        REQUIRE(array->sequence < g->sequence);
+        REQUIRE(g->sequence < surface->sequence);
+      }
+      REQUIRE(surface->sequence < group->sequence);
+    }
+  }
+}
+
+} // namespace
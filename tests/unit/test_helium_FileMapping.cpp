@@ -0,0 +1,98 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/utility/FileMapping.h"
+// std
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+SCENARIO("helium::mapFile()", "[helium_FileMapping]")
+{
+  GIVEN("A file containing a header followed by array data")
+  {
+    const std::string path = "helium_FileMapping_test.bin";
+    const char header[13] = "cache header";
+    std::vector<float> values(10000);
+    for (size_t i = 0; i < values.size(); i++)
+      values[i] = float(i);
+
+    {
+      std::ofstream out(path, std::ios::binary);
+      out.write(header, sizeof(header));
+      out.write((const char *)values.data(), values.size() * sizeof(float));
+    }
+
+    const size_t numBytes = values.size() * sizeof(float);
+    const void *deleterPtr = nullptr;
+    std::string error;
+
+    THEN("Data after the unaligned header can be mapped and written to")
+    {
+      auto *mem = (float *)helium::mapFile(
+          path.c_str(), sizeof(header), numBytes, &deleterPtr, error);
+      REQUIRE(mem != nullptr);
+      REQUIRE(error.empty());
+
+      float first = 0.f, last = 0.f;
+      std::memcpy(&first, mem, sizeof(float));
+      std::memcpy(&last, mem + values.size() - 1, sizeof(float));
+      REQUIRE(first == values.front());
+      REQUIRE(last == values.back());
+
+      std::memset(mem, 0xFF, numBytes);
+      helium::unmapFile(deleterPtr, mem);
+
+      AND_THEN("Writes do not reach the file")
+      {
+        mem = (float *)helium::mapFile(
+            path.c_str(), sizeof(header), numBytes, &deleterPtr, error);
+        REQUIRE(mem != nullptr);
+        REQUIRE(std::memcmp(mem, values.data(), numBytes) == 0);
+        helium::unmapFile(deleterPtr, mem);
+      }
+    }
+
+    THEN("Mapping past the end of the file fails")
+    {
+      void *mem = helium::mapFile(
+          path.c_str(), sizeof(header) + 1, numBytes, &deleterPtr, error);
+      REQUIRE(mem == nullptr);
+      REQUIRE(!error.empty());
+    }
+
+    THEN("Sizes wrapping around past the end of the file are rejected")
+    {
+      void *mem = helium::mapFile(path.c_str(),
+          sizeof(header),
+          ~size_t(0) - sizeof(header) + 2,
+          &deleterPtr,
+          error);
+      REQUIRE(mem == nullptr);
+      REQUIRE(!error.empty());
+    }
+
+    std::remove(path.c_str());
+  }
+
+  GIVEN("A file which does not exist")
+  {
+    const void *deleterPtr = nullptr;
+    std::string error;
+    void *mem = helium::mapFile(
+        "helium_FileMapping_missing.bin", 0, 16, &deleterPtr, error);
+
+    THEN("Mapping it fails")
+    {
+      REQUIRE(mem == nullptr);
+      REQUIRE(!error.empty());
+    }
+  }
+}
+
+} // namespace
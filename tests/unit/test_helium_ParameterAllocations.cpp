@@ -0,0 +1,135 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/utility/ParameterizedObject.h"
+// std
+#include <cstdlib>
+#include <new>
+
+// Heap allocations are only counted on a thread while an AllocationCounter
+// is alive there, so the rest of the test executable is unaffected
+static thread_local size_t *t_allocationCount{nullptr};
+
+void *operator new(size_t size)
+{
+  if (t_allocationCount)
+    (*t_allocationCount)++;
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace {
+
+using helium::AnariAny;
+using helium::ParameterizedObject;
+
+struct AllocationCounter
+{
+  AllocationCounter()
+  {
+    t_allocationCount = &count;
+  }
+  ~AllocationCounter()
+  {
+    t_allocationCount = nullptr;
+  }
+
+  size_t count{0};
+};
+
+struct TestParameters
+{
+  float radius{1.f};
+  float color[3] = {1.f, 0.5f, 0.f};
+  float transform[16] = {1.f, 0.f, 0.f, 0.f, // column 0
+      0.f, 1.f, 0.f, 0.f, // column 1
+      0.f, 0.f, 1.f, 0.f, // column 2
+      0.f, 0.f, 0.f, 1.f}; // column 3
+  const char *name = "first short string";
+
+  void setOn(ParameterizedObject &obj)
+  {
+    obj.setParam("radius", ANARI_FLOAT32, &radius);
+    obj.setParam("color", ANARI_FLOAT32_VEC3, color);
+    obj.setParam("transform", ANARI_FLOAT32_MAT4, transform);
+    obj.setParam("name", ANARI_STRING, name);
+  }
+
+  void change()
+  {
+    radius += 1.f;
+    color[0] += 1.f;
+    transform[12] += 1.f;
+    name = name[0] == 'f' ? "second short string" : "first short string";
+  }
+};
+
+SCENARIO("helium::ParameterizedObject parameter allocations",
+    "[helium_ParameterAllocations]")
+{
+  GIVEN("An object with scalar, vector, matrix and short string parameters")
+  {
+    ParameterizedObject obj;
+    TestParameters params;
+    params.setOn(obj);
+
+    THEN("Setting new values does not allocate")
+    {
+      size_t allocations = 0;
+      {
+        AllocationCounter counter;
+        for (int i = 0; i < 100; i++) {
+          params.change();
+          params.setOn(obj);
+        }
+        allocations = counter.count;
+      }
+      REQUIRE(allocations == 0);
+      REQUIRE(obj.getParam<float>("radius", 0.f) == params.radius);
+      REQUIRE(obj.getParamString("name", "") == params.name);
+    }
+
+    THEN("Copying and moving the values does not allocate")
+    {
+      size_t allocations = 0;
+      {
+        AllocationCounter counter;
+        AnariAny name = obj.getParamDirect("name");
+        AnariAny transform = obj.getParamDirect("transform");
+        obj.setParamDirect("name", std::move(transform));
+        obj.setParamDirect("transform", name);
+        allocations = counter.count;
+      }
+      REQUIRE(allocations == 0);
+      REQUIRE(obj.getParamDirect("transform").getStringView() == params.name);
+    }
+  }
+
+  GIVEN("A string parameter longer than the local storage of AnariAny")
+  {
+    const std::string longString(200, 'x');
+    AnariAny v(longString.c_str());
+
+    THEN("The string is stored on the heap and can be copied")
+    {
+      AnariAny copy = v;
+      REQUIRE(copy.getString() == longString);
+      REQUIRE(copy == v);
+    }
+  }
+}
+
+} // namespace
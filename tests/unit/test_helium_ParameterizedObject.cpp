@@ -115,6 +115,103 @@ SCENARIO(
       }
     }
   }
+
+  GIVEN("A ParameterizedObject with an int and a string parameter")
+  {
+    helium::ParameterizedObject obj;
+
+    int v = 5;
+    const char *testStr = "test";
+    REQUIRE(obj.setParam("test_int", ANARI_INT32, &v));
+    REQUIRE(obj.setParam("test_string", ANARI_STRING, testStr));
+
+    THEN("Setting identical values reports no change")
+    {
+      int same = 5;
+      std::string sameStr = "test";
+      REQUIRE(!obj.setParam("test_int", ANARI_INT32, &same));
+      REQUIRE(!obj.setParam("test_string", ANARI_STRING, sameStr.c_str()));
+    }
+
+    THEN("Setting a different value or type reports a change")
+    {
+      int other = 6;
+      float f = 5.f;
+      REQUIRE(obj.setParam("test_int", ANARI_INT32, &other));
+      REQUIRE(obj.setParam("test_int", ANARI_FLOAT32, &f));
+      REQUIRE(obj.setParam("test_string", ANARI_STRING, "other"));
+    }
+
+    THEN("Only removing an existing parameter reports a change")
+    {
+      REQUIRE(obj.removeParam("test_int"));
+      REQUIRE(!obj.removeParam("test_int"));
+    }
+  }
+}
+
+SCENARIO("helium::ParamName interning", "[helium_ParameterizedObject]")
+{
+  GIVEN("Names known to the ANARI API and unknown names")
+  {
+    helium::ParamName known("color");
+    helium::ParamName unknown("helium_test_unknown_name");
+
+    THEN("Interning the same string again gives the same name")
+    {
+      REQUIRE(known == helium::ParamName(std::string("color")));
+      REQUIRE(known == helium::ParamName(std::string_view("color")));
+      REQUIRE(unknown == helium::ParamName("helium_test_unknown_name"));
+    }
+
+    THEN("Different strings give different names")
+    {
+      REQUIRE(known != unknown);
+      REQUIRE(known != helium::ParamName("colors"));
+      REQUIRE(known != helium::ParamName("colo"));
+      REQUIRE(unknown != helium::ParamName("helium_test_unknown_nam"));
+    }
+
+    THEN("The original string can be recovered")
+    {
+      REQUIRE(known.str() == "color");
+      REQUIRE(unknown.str() == "helium_test_unknown_name");
+    }
+
+    THEN("Strings which are not null terminated are interned by length")
+    {
+      const char *str = "colorXYZ";
+      REQUIRE(helium::ParamName(std::string_view(str, 5)) == known);
+    }
+  }
+
+  GIVEN("A ParameterizedObject with a parameter set through a ParamName")
+  {
+    helium::ParameterizedObject obj;
+    helium::ParamName name("radius");
+
+    obj.setParam(name, 2.f);
+
+    THEN("The parameter can be read with a string or a ParamName")
+    {
+      REQUIRE(obj.hasParam("radius"));
+      REQUIRE(obj.getParam<float>(name, 1.f) == 2.f);
+      REQUIRE(obj.getParam<float>(std::string_view("radius"), 1.f) == 2.f);
+      REQUIRE(obj.getParam<float>(std::string("radius"), 1.f) == 2.f);
+    }
+
+    WHEN("The parameter is set again")
+    {
+      obj.setParam("radius", 3.f);
+
+      THEN("The value is replaced instead of added")
+      {
+        REQUIRE(obj.getParam<float>(name, 1.f) == 3.f);
+        obj.removeParam(name);
+        REQUIRE(!obj.hasParam("radius"));
+      }
+    }
+  }
 }
 
 } // namespace
@@ -0,0 +1,81 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/utility/SlabAllocator.h"
+// std
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using helium::SlabAllocator;
+
+SCENARIO("helium::SlabAllocator interface", "[helium_SlabAllocator]")
+{
+  GIVEN("An empty allocator")
+  {
+    SlabAllocator allocator;
+
+    THEN("No memory is used or reserved")
+    {
+      REQUIRE(allocator.bytesInUse() == 0);
+      REQUIRE(allocator.bytesReserved() == 0);
+    }
+
+    WHEN("Many small blocks are allocated")
+    {
+      std::vector<void *> blocks;
+      for (int i = 0; i < 1000; i++) {
+        blocks.push_back(allocator.allocate(100));
+        std::memset(blocks.back(), i & 0xFF, 100);
+      }
+
+      THEN("Blocks are aligned, distinct and fill whole slabs")
+      {
+        for (size_t i = 0; i < blocks.size(); i++) {
+          REQUIRE((uintptr_t)blocks[i] % SlabAllocator::BLOCK_ALIGNMENT == 0);
+          REQUIRE(((unsigned char *)blocks[i])[99] == (i & 0xFF));
+        }
+        REQUIRE(allocator.bytesInUse() == 1000 * 112);
+        REQUIRE(allocator.bytesReserved() % SlabAllocator::SLAB_SIZE == 0);
+        REQUIRE(allocator.bytesReserved()
+            < 1000 * 112 + SlabAllocator::SLAB_SIZE);
+      }
+
+      THEN("Freed blocks are reused without reserving more memory")
+      {
+        const size_t reserved = allocator.bytesReserved();
+        for (void *b : blocks)
+          allocator.free(b, 100);
+        REQUIRE(allocator.bytesInUse() == 0);
+
+        for (int i = 0; i < 1000; i++)
+          blocks[i] = allocator.allocate(97);
+        REQUIRE(allocator.bytesReserved() == reserved);
+
+        for (void *b : blocks)
+          allocator.free(b, 97);
+      }
+    }
+
+    WHEN("A block larger than the largest size class is allocated")
+    {
+      const size_t size = SlabAllocator::MAX_BLOCK_SIZE + 1;
+      void *mem = allocator.allocate(size);
+
+      THEN("It is tracked and can be freed")
+      {
+        REQUIRE(mem != nullptr);
+        REQUIRE(allocator.bytesInUse() == size);
+        allocator.free(mem, size);
+        REQUIRE(allocator.bytesInUse() == 0);
+        REQUIRE(allocator.bytesReserved() == 0);
+      }
+    }
+  }
+}
+
+} // namespace
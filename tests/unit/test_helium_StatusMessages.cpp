@@ -0,0 +1,164 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/BaseObject.h"
+// std
+#include <string>
+#include <vector>
+
+namespace {
+
+using helium::BaseObject;
+
+struct TestObject : public BaseObject
+{
+  TestObject(helium::BaseGlobalDeviceState *s) : BaseObject(ANARI_GEOMETRY, s)
+  {}
+
+  bool getProperty(const std::string_view &, ANARIDataType, void *, uint32_t)
+      override
+  {
+    return false;
+  }
+
+  void commit() override {}
+};
+
+struct Message
+{
+  ANARIStatusSeverity severity;
+  std::string text;
+};
+
+static void statusFunc(const void *userPtr,
+    ANARIDevice,
+    ANARIObject,
+    ANARIDataType,
+    ANARIStatusSeverity severity,
+    ANARIStatusCode,
+    const char *message)
+{
+  auto *messages = (std::vector<Message> *)userPtr;
+  messages->push_back({severity, message});
+}
+
+struct NestingState
+{
+  BaseObject *obj{nullptr};
+  std::vector<Message> messages;
+};
+
+// Reports a longer message from inside the callback before recording the
+// outer one, as a callback calling back into the device would
+static void nestingStatusFunc(const void *userPtr,
+    ANARIDevice,
+    ANARIObject,
+    ANARIDataType,
+    ANARIStatusSeverity severity,
+    ANARIStatusCode,
+    const char *message)
+{
+  auto *s = (NestingState *)userPtr;
+  if (std::string(message) == "outer") {
+    const std::string longText(1000, 'x');
+    s->obj->reportMessage(ANARI_SEVERITY_INFO, "%s", longText.c_str());
+  }
+  s->messages.push_back({severity, message});
+}
+
+SCENARIO("helium::BaseObject status messages", "[helium_StatusMessages]")
+{
+  GIVEN("An object of a device with a status callback")
+  {
+    std::vector<Message> messages;
+    helium::BaseGlobalDeviceState state{nullptr};
+    state.statusCB = statusFunc;
+    state.statusCBUserPtr = &messages;
+
+    auto *obj = new TestObject(&state);
+
+    THEN("Messages of all severities are reported by default")
+    {
+      obj->reportMessage(ANARI_SEVERITY_DEBUG, "debug %i", 1);
+      obj->reportMessage(ANARI_SEVERITY_ERROR, "error %s", "two");
+      REQUIRE(messages.size() == 2);
+      REQUIRE(messages[0].severity == ANARI_SEVERITY_DEBUG);
+      REQUIRE(messages[0].text == "debug 1");
+      REQUIRE(messages[1].severity == ANARI_SEVERITY_ERROR);
+      REQUIRE(messages[1].text == "error two");
+    }
+
+    WHEN("The minimum severity is raised to warnings")
+    {
+      state.statusMinSeverity = ANARI_SEVERITY_WARNING;
+
+      THEN("Less severe messages are dropped")
+      {
+        obj->reportMessage(ANARI_SEVERITY_DEBUG, "debug");
+        obj->reportMessage(ANARI_SEVERITY_INFO, "info");
+        obj->reportMessage(ANARI_SEVERITY_PERFORMANCE_WARNING, "perf");
+        REQUIRE(messages.empty());
+      }
+
+      THEN("Messages at least as severe are reported")
+      {
+        obj->reportMessage(ANARI_SEVERITY_WARNING, "warning");
+        obj->reportMessage(ANARI_SEVERITY_FATAL_ERROR, "fatal");
+        REQUIRE(messages.size() == 2);
+        REQUIRE(messages[0].text == "warning");
+        REQUIRE(messages[1].text == "fatal");
+      }
+    }
+
+    WHEN("There is no status callback")
+    {
+      state.statusCB = nullptr;
+
+      THEN("Nothing is reported")
+      {
+        obj->reportMessage(ANARI_SEVERITY_ERROR, "error");
+        REQUIRE(messages.empty());
+      }
+    }
+
+    THEN("Messages longer than earlier ones on the same thread are complete")
+    {
+      const std::string longText(1000, 'x');
+      obj->reportMessage(ANARI_SEVERITY_INFO, "short");
+      obj->reportMessage(ANARI_SEVERITY_INFO, "%s!", longText.c_str());
+      obj->reportMessage(ANARI_SEVERITY_INFO, "%i", 42);
+      REQUIRE(messages.size() == 3);
+      REQUIRE(messages[0].text == "short");
+      REQUIRE(messages[1].text == longText + "!");
+      REQUIRE(messages[2].text == "42");
+    }
+
+    obj->refDec(helium::RefType::PUBLIC);
+  }
+
+  GIVEN("A status callback which reports another message")
+  {
+    NestingState nesting;
+    helium::BaseGlobalDeviceState state{nullptr};
+    state.statusCB = nestingStatusFunc;
+    state.statusCBUserPtr = &nesting;
+
+    auto *obj = new TestObject(&state);
+    nesting.obj = obj;
+
+    THEN("The outer message is unchanged by the nested one")
+    {
+      obj->reportMessage(ANARI_SEVERITY_WARNING, "outer");
+      REQUIRE(nesting.messages.size() == 2);
+      REQUIRE(nesting.messages[0].text == std::string(1000, 'x'));
+      REQUIRE(nesting.messages[1].severity == ANARI_SEVERITY_WARNING);
+      REQUIRE(nesting.messages[1].text == "outer");
+    }
+
+    obj->refDec(helium::RefType::PUBLIC);
+  }
+}
+
+} // namespace